@@ -1,167 +1,566 @@
 #include "Common.hpp"
+#include "StringColumn.hpp"
+#include "ThreadPool.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cctype>
-#include <functional>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define __TEXT__COMMON_SSE2__
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define __TEXT__COMMON_AVX2__
+#endif
 
 namespace Text
 {
   static bool __isWhitespace(char chr) { return std::isspace(chr) != 0; }
 
-  bool IsWhitespace(const std::string& value) { return std::find_if_not(value.cbegin(), value.cend(), __isWhitespace) == value.cend(); }
+  static char __foldCase(char chr) { return (chr >= 'A' && chr <= 'Z') ? static_cast<char>(chr | 0x20) : chr; }
 
-  bool CompareIgnoreCase(const std::string& a, const std::string& b)
+  static std::uint64_t __foldCase(std::uint64_t value)
   {
-    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](char a, char b) { return std::tolower(a) == std::tolower(b); });
+    constexpr std::uint64_t ones = 0x0101010101010101u;
+    const std::uint64_t heptets = value & (ones * 0x7Fu);
+    const std::uint64_t mask    = (heptets + ones * (0x80u - 'A')) & ~(heptets + ones * (0x80u - 'Z' - 1u)) & ~value & (ones * 0x80u);
+    return value | (mask >> 2);
   }
 
-  static void __toCase(const std::string::iterator& begin, const std::string::const_iterator& end, const std::function<char(char)>& callback)
+#ifdef __TEXT__COMMON_SSE2__
+  static __m128i __isInRange(__m128i chunk, char first, char last)
   {
-    std::string::iterator iter = begin;
-    while(iter != end)
+    return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(static_cast<char>(first - 1))),
+                         _mm_cmplt_epi8(chunk, _mm_set1_epi8(static_cast<char>(last + 1))));
+  }
+
+  static __m128i __foldCase(__m128i chunk) { return _mm_or_si128(chunk, _mm_and_si128(__isInRange(chunk, 'A', 'Z'), _mm_set1_epi8(0x20))); }
+#endif
+
+  bool CompareIgnoreCase(std::string_view a, std::string_view b)
+  {
+    if(a.size() != b.size())
     {
-      *iter = callback(*iter);
-      iter++;
+      return false;
     }
+
+    const char* iterA = a.data();
+    const char* iterB = b.data();
+    const char* end   = iterA + a.size();
+#ifdef __TEXT__COMMON_SSE2__
+    for(; end - iterA >= 16; iterA += 16, iterB += 16)
+    {
+      const __m128i chunkA = __foldCase(_mm_loadu_si128(reinterpret_cast<const __m128i*>(iterA)));
+      const __m128i chunkB = __foldCase(_mm_loadu_si128(reinterpret_cast<const __m128i*>(iterB)));
+      if(_mm_movemask_epi8(_mm_cmpeq_epi8(chunkA, chunkB)) != 0xFFFF)
+      {
+        return false;
+      }
+    }
+#endif
+
+    for(; iterA != end; iterA++, iterB++)
+    {
+      if(__foldCase(*iterA) != __foldCase(*iterB))
+      {
+        return false;
+      }
+    }
+
+    return true;
   }
 
-  static void __toCase(const std::string::const_iterator& begin,
-                       const std::string::const_iterator& end,
-                       std::back_insert_iterator<std::string> result,
-                       const std::function<char(char)>& callback)
+  static std::uint64_t __mix(std::uint64_t a, std::uint64_t b)
   {
-    std::string::const_iterator iter = begin;
-    while(iter != end)
+#ifdef __SIZEOF_INT128__
+    __extension__ typedef unsigned __int128 UInt128;
+    const UInt128 result = static_cast<UInt128>(a) * b;
+    return static_cast<std::uint64_t>(result) ^ static_cast<std::uint64_t>(result >> 64u);
+#else
+    const std::uint64_t aHigh = a >> 32u;
+    const std::uint64_t aLow  = a & 0xFFFFFFFFu;
+    const std::uint64_t bHigh = b >> 32u;
+    const std::uint64_t bLow  = b & 0xFFFFFFFFu;
+    const std::uint64_t cross = (aLow * bLow >> 32u) + (aHigh * bLow & 0xFFFFFFFFu) + aLow * bHigh;
+    return (a * b) ^ (aHigh * bHigh + (aHigh * bLow >> 32u) + (cross >> 32u));
+#endif
+  }
+
+  template<bool IsFolding>
+  static std::uint64_t __read(const char* iter, std::size_t size)
+  {
+    std::uint64_t result = 0u;
+    std::memcpy(&result, iter, size);
+    if constexpr(IsFolding)
+    {
+      result = __foldCase(result);
+    }
+
+    return result;
+  }
+
+  template<bool IsFolding>
+  static std::size_t __hash(std::string_view value)
+  {
+    constexpr std::uint64_t secrets[] = {0xA0761D6478BD642Fu, 0xE7037ED1A0B428DBu, 0x8EBC6AF09C88C6E3u, 0x589965CC75374CC3u};
+
+    const char* iter   = value.data();
+    std::size_t size   = value.size();
+    std::uint64_t seed = __mix(secrets[0], secrets[1]);
+    std::uint64_t a;
+    std::uint64_t b;
+    if(size <= 16u)
+    {
+      if(size >= 4u)
+      {
+        const std::size_t offset = (size >> 3u) << 2u;
+        a                        = (__read<IsFolding>(iter, 4u) << 32u) | __read<IsFolding>(iter + offset, 4u);
+        b                        = (__read<IsFolding>(iter + size - 4u, 4u) << 32u) | __read<IsFolding>(iter + size - 4u - offset, 4u);
+      }
+      else if(size > 0u)
+      {
+        a = (__read<IsFolding>(iter, 1u) << 16u) | (__read<IsFolding>(iter + (size >> 1u), 1u) << 8u) | __read<IsFolding>(iter + size - 1u, 1u);
+        b = 0u;
+      }
+      else
+      {
+        a = 0u;
+        b = 0u;
+      }
+    }
+    else
+    {
+      for(; size > 16u; iter += 16, size -= 16u)
+      {
+        seed = __mix(__read<IsFolding>(iter, 8u) ^ secrets[1], __read<IsFolding>(iter + 8, 8u) ^ seed);
+      }
+
+      a = __read<IsFolding>(iter + size - 16u, 8u);
+      b = __read<IsFolding>(iter + size - 8u, 8u);
+    }
+
+    return static_cast<std::size_t>(__mix(secrets[1] ^ value.size(), __mix(a ^ secrets[1], b ^ seed)));
+  }
+
+  std::size_t HashString(std::string_view value) { return __hash<false>(value); }
+
+  std::size_t HashIgnoreCase(std::string_view value) { return __hash<true>(value); }
+
+  static std::size_t __getEditDistance(std::string_view pattern, std::string_view text)
+  {
+    thread_local std::array<std::uint64_t, 256u> equalities {};
+    for(std::size_t i = 0u; i < pattern.size(); i++)
+    {
+      equalities[static_cast<unsigned char>(pattern[i])] |= std::uint64_t(1u) << i;
+    }
+
+    const std::uint64_t last = std::uint64_t(1u) << (pattern.size() - 1u);
+    std::uint64_t positive   = ~std::uint64_t(0u);
+    std::uint64_t negative   = 0u;
+    std::size_t result       = pattern.size();
+    for(char chr : text)
+    {
+      const std::uint64_t equality   = equalities[static_cast<unsigned char>(chr)];
+      const std::uint64_t vertical   = equality | negative;
+      const std::uint64_t horizontal = (((equality & positive) + positive) ^ positive) | equality;
+
+      std::uint64_t horizontalPositive = negative | ~(horizontal | positive);
+      std::uint64_t horizontalNegative = positive & horizontal;
+      result += static_cast<std::size_t>((horizontalPositive & last) != 0u);
+      result -= static_cast<std::size_t>((horizontalNegative & last) != 0u);
+
+      horizontalPositive = (horizontalPositive << 1u) | 1u;
+      horizontalNegative <<= 1u;
+      positive = horizontalNegative | ~(vertical | horizontalPositive);
+      negative = horizontalPositive & vertical;
+    }
+
+    for(char chr : pattern)
+    {
+      equalities[static_cast<unsigned char>(chr)] = 0u;
+    }
+
+    return result;
+  }
+
+  std::size_t EditDistance(std::string_view a, std::string_view b)
+  {
+    if(a.size() > b.size())
+    {
+      std::swap(a, b);
+    }
+
+    const std::size_t prefixSize = static_cast<std::size_t>(std::mismatch(a.cbegin(), a.cend(), b.cbegin()).first - a.cbegin());
+    a.remove_prefix(prefixSize);
+    b.remove_prefix(prefixSize);
+
+    const std::size_t suffixSize = static_cast<std::size_t>(std::mismatch(a.crbegin(), a.crend(), b.crbegin()).first - a.crbegin());
+    a.remove_suffix(suffixSize);
+    b.remove_suffix(suffixSize);
+
+    if(a.empty())
+    {
+      return b.size();
+    }
+    else if(a.size() <= 64u)
+    {
+      return __getEditDistance(a, b);
+    }
+
+    std::vector<std::size_t> distances(a.size() + 1u);
+    for(std::size_t i = 0u; i < distances.size(); i++)
+    {
+      distances[i] = i;
+    }
+
+    for(std::size_t j = 1u; j <= b.size(); j++)
+    {
+      std::size_t diagonal = distances[0];
+      distances[0]         = j;
+      for(std::size_t i = 1u; i <= a.size(); i++)
+      {
+        const std::size_t tmpDistance = distances[i];
+        distances[i]                  = std::min({distances[i] + 1u, distances[i - 1u] + 1u, diagonal + ((a[i - 1u] != b[j - 1u]) ? 1u : 0u)});
+        diagonal                      = tmpDistance;
+      }
+    }
+
+    return distances.back();
+  }
+
+  std::size_t StringHash::operator()(std::string_view value) const { return HashString(value); }
+
+  std::size_t CaseInsensitiveHash::operator()(std::string_view value) const { return HashIgnoreCase(value); }
+
+  bool CaseInsensitiveEqual::operator()(std::string_view a, std::string_view b) const { return CompareIgnoreCase(a, b); }
+
+  static char __toAsciiCase(char chr, char first, char last) { return (chr >= first && chr <= last) ? static_cast<char>(chr ^ 0x20) : chr; }
+
+#ifdef __TEXT__COMMON_AVX2__
+  static bool __isAvx2Supported()
+  {
+    static const bool result = (__builtin_cpu_init(), __builtin_cpu_supports("avx2") != 0);
+    return result;
+  }
+
+  __attribute__((target("avx2"))) static void __toAsciiCaseAvx2(const char*& begin, const char* end, char*& result, char first, char last)
+  {
+    const __m256i lower = _mm256_set1_epi8(static_cast<char>(first - 1));
+    const __m256i upper = _mm256_set1_epi8(static_cast<char>(last + 1));
+    const __m256i flip  = _mm256_set1_epi8(0x20);
+    for(; end - begin >= 32; begin += 32, result += 32)
+    {
+      const __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+      const __m256i mask  = _mm256_and_si256(_mm256_cmpgt_epi8(chunk, lower), _mm256_cmpgt_epi8(upper, chunk));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(result), _mm256_xor_si256(chunk, _mm256_and_si256(mask, flip)));
+    }
+  }
+#endif
+
+#ifdef __TEXT__COMMON_SSE2__
+  static void __toAsciiCaseSse2(const char*& begin, const char* end, char*& result, char first, char last)
+  {
+    const __m128i lower = _mm_set1_epi8(static_cast<char>(first - 1));
+    const __m128i upper = _mm_set1_epi8(static_cast<char>(last + 1));
+    const __m128i flip  = _mm_set1_epi8(0x20);
+    for(; end - begin >= 16; begin += 16, result += 16)
+    {
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+      const __m128i mask  = _mm_and_si128(_mm_cmpgt_epi8(chunk, lower), _mm_cmplt_epi8(chunk, upper));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm_xor_si128(chunk, _mm_and_si128(mask, flip)));
+    }
+  }
+#endif
+
+  static void __toAsciiCase(const char* begin, const char* end, char* result, char first, char last)
+  {
+#ifdef __TEXT__COMMON_AVX2__
+    if(__isAvx2Supported())
+    {
+      __toAsciiCaseAvx2(begin, end, result, first, last);
+    }
+#endif
+
+#ifdef __TEXT__COMMON_SSE2__
+    __toAsciiCaseSse2(begin, end, result, first, last);
+#endif
+
+    while(begin != end)
     {
-      *result = callback(*iter);
-      iter++;
+      *result++ = __toAsciiCase(*begin++, first, last);
     }
   }
 
   std::string& ToLowercase(std::string& value)
   {
-    __toCase(value.begin(), value.cend(), [](char chr) { return static_cast<char>(std::tolower(chr)); });
+    __toAsciiCase(value.data(), value.data() + value.size(), value.data(), 'A', 'Z');
     return value;
   }
 
   std::string& ToUppercase(std::string& value)
   {
-    __toCase(value.begin(), value.cend(), [](char chr) { return static_cast<char>(std::toupper(chr)); });
+    __toAsciiCase(value.data(), value.data() + value.size(), value.data(), 'a', 'z');
     return value;
   }
 
-  std::string& ToTitleCase(std::string& value)
+  static char __toTitleCase(char chr, bool& isQualifier)
   {
-    bool isQualifier = true;
-    __toCase(value.begin(), value.cend(), [&isQualifier](char chr) {
-      const char tmpResult = static_cast<char>(isQualifier ? std::toupper(chr) : std::tolower(chr));
-      isQualifier          = (std::isspace(chr) != 0) || (std::ispunct(chr) != 0);
-      return tmpResult;
-    });
+    const char result = static_cast<char>(isQualifier ? std::toupper(chr) : std::tolower(chr));
+    isQualifier       = (std::isspace(chr) != 0) || (std::ispunct(chr) != 0);
+    return result;
+  }
 
-    return value;
+  static char __toSentenceCase(char chr, bool& isQualifier)
+  {
+    if(std::isalpha(chr) != 0)
+    {
+      const char result = static_cast<char>(isQualifier ? std::toupper(chr) : std::tolower(chr));
+      isQualifier       = false;
+      return result;
+    }
+    else
+    {
+      if(chr == '.')
+      {
+        isQualifier = true;
+      }
+
+      return chr;
+    }
   }
 
-  std::string& ToSentenceCase(std::string& value)
+#ifdef __TEXT__COMMON_SSE2__
+  static void __toTitleCaseSse2(const char*& begin, const char* end, char*& result, bool& isQualifier)
   {
-    bool isQualifier = true;
-    __toCase(value.begin(), value.cend(), [&isQualifier](char chr) {
-      if(std::isalpha(chr) != 0)
+    const __m128i flip = _mm_set1_epi8(0x20);
+    __m128i boundaries = isQualifier ? _mm_set1_epi8(-1) : _mm_setzero_si128();
+    for(; end - begin >= 16; begin += 16, result += 16)
+    {
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+      const __m128i carry = _mm_srli_si128(boundaries, 15);
+
+      boundaries = _mm_or_si128(_mm_or_si128(__isInRange(chunk, '\t', '\r'), __isInRange(chunk, ' ', '/')),
+                                _mm_or_si128(_mm_or_si128(__isInRange(chunk, ':', '@'), __isInRange(chunk, '[', '`')), __isInRange(chunk, '{', '~')));
+
+      const __m128i qualifiers = _mm_or_si128(_mm_slli_si128(boundaries, 1), carry);
+      const __m128i mask       = _mm_or_si128(_mm_and_si128(qualifiers, __isInRange(chunk, 'a', 'z')),
+                                        _mm_andnot_si128(qualifiers, __isInRange(chunk, 'A', 'Z')));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm_xor_si128(chunk, _mm_and_si128(mask, flip)));
+    }
+
+    isQualifier = (_mm_movemask_epi8(boundaries) & 0x8000) != 0;
+  }
+
+  static void __toSentenceCaseSse2(const char*& begin, const char* end, char*& result, bool& isQualifier)
+  {
+    const __m128i flip = _mm_set1_epi8(0x20);
+    const __m128i dot  = _mm_set1_epi8('.');
+    for(; end - begin >= 16; begin += 16, result += 16)
+    {
+      const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+      if(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, dot)) != 0)
       {
-        const char tmpResult = static_cast<char>(isQualifier ? std::toupper(chr) : std::tolower(chr));
-        isQualifier          = false;
-        return tmpResult;
+        for(std::size_t i = 0u; i < 16u; i++)
+        {
+          result[i] = __toSentenceCase(begin[i], isQualifier);
+        }
+
+        continue;
       }
-      else
+
+      const __m128i uppercase = __isInRange(chunk, 'A', 'Z');
+      const int letters       = _mm_movemask_epi8(_mm_or_si128(uppercase, __isInRange(chunk, 'a', 'z')));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm_xor_si128(chunk, _mm_and_si128(uppercase, flip)));
+      if(letters != 0 && isQualifier)
       {
-        if(chr == '.')
+        int first = 0;
+        while(((letters >> first) & 1) == 0)
         {
-          isQualifier = true;
+          first++;
         }
 
-        return chr;
+        result[first] = static_cast<char>(std::toupper(result[first]));
+        isQualifier   = false;
       }
-    });
+    }
+  }
+#endif
+
+  static void __toTitleCase(const char* begin, const char* end, char* result)
+  {
+    bool isQualifier = true;
+#ifdef __TEXT__COMMON_SSE2__
+    __toTitleCaseSse2(begin, end, result, isQualifier);
+#endif
+
+    while(begin != end)
+    {
+      *result++ = __toTitleCase(*begin++, isQualifier);
+    }
+  }
+
+  static void __toSentenceCase(const char* begin, const char* end, char* result)
+  {
+    bool isQualifier = true;
+#ifdef __TEXT__COMMON_SSE2__
+    __toSentenceCaseSse2(begin, end, result, isQualifier);
+#endif
+
+    while(begin != end)
+    {
+      *result++ = __toSentenceCase(*begin++, isQualifier);
+    }
+  }
+
+  std::string& ToTitleCase(std::string& value)
+  {
+    __toTitleCase(value.data(), value.data() + value.size(), value.data());
+    return value;
+  }
 
+  std::string& ToSentenceCase(std::string& value)
+  {
+    __toSentenceCase(value.data(), value.data() + value.size(), value.data());
     return value;
   }
 
   std::string ToLowercaseCopy(const std::string& value)
   {
-    std::string result;
-    result.reserve(value.size());
-    __toCase(value.cbegin(), value.cend(), std::back_inserter(result), [](char chr) { return static_cast<char>(std::tolower(chr)); });
+    std::string result(value.size(), '\0');
+    __toAsciiCase(value.data(), value.data() + value.size(), result.data(), 'A', 'Z');
     return result;
   }
 
   std::string ToUppercaseCopy(const std::string& value)
   {
-    std::string result;
-    result.reserve(value.size());
-    __toCase(value.cbegin(), value.cend(), std::back_inserter(result), [](char chr) { return static_cast<char>(std::toupper(chr)); });
+    std::string result(value.size(), '\0');
+    __toAsciiCase(value.data(), value.data() + value.size(), result.data(), 'a', 'z');
     return result;
   }
 
   std::string ToTitleCaseCopy(const std::string& value)
   {
-    std::string result;
-    result.reserve(value.size());
-
-    bool isQualifier = true;
-    __toCase(value.cbegin(), value.cend(), std::back_inserter(result), [&isQualifier](char chr) {
-      const char tmpResult = static_cast<char>(isQualifier ? std::toupper(chr) : std::tolower(chr));
-      isQualifier          = (std::isspace(chr) != 0) || (std::ispunct(chr) != 0);
-      return tmpResult;
-    });
-
+    std::string result(value.size(), '\0');
+    __toTitleCase(value.data(), value.data() + value.size(), result.data());
     return result;
   }
 
   std::string ToSentenceCaseCopy(const std::string& value)
   {
-    std::string result;
-    result.reserve(value.size());
+    std::string result(value.size(), '\0');
+    __toSentenceCase(value.data(), value.data() + value.size(), result.data());
+    return result;
+  }
 
-    bool isQualifier = true;
-    __toCase(value.cbegin(), value.cend(), std::back_inserter(result), [&isQualifier](char chr) {
-      if(std::isalpha(chr) != 0)
+#ifdef __TEXT__COMMON_SSE2__
+  static int __getWhitespaceMask(const char* iter)
+  {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(iter));
+    return _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')), __isInRange(chunk, '\t', '\r')));
+  }
+#endif
+
+  static const char* __findFirstNonWhitespace(const char* begin, const char* end)
+  {
+#ifdef __TEXT__COMMON_SSE2__
+    for(; end - begin >= 16; begin += 16)
+    {
+      const int mask = __getWhitespaceMask(begin);
+      if(mask != 0xFFFF)
       {
-        const char tmpResult = static_cast<char>(isQualifier ? std::toupper(chr) : std::tolower(chr));
-        isQualifier          = false;
-        return tmpResult;
+        int index = 0;
+        while(((mask >> index) & 1) != 0)
+        {
+          index++;
+        }
+
+        return begin + index;
       }
-      else
+    }
+#endif
+
+    return std::find_if_not(begin, end, __isWhitespace);
+  }
+
+  static const char* __findLastNonWhitespace(const char* begin, const char* end)
+  {
+#ifdef __TEXT__COMMON_SSE2__
+    for(; end - begin >= 16; end -= 16)
+    {
+      const int mask = __getWhitespaceMask(end - 16);
+      if(mask != 0xFFFF)
       {
-        if(chr == '.')
+        int index = 15;
+        while(((mask >> index) & 1) != 0)
         {
-          isQualifier = true;
+          index--;
         }
 
-        return chr;
+        return end - 16 + index + 1;
       }
-    });
+    }
+#endif
 
-    return result;
+    while(end != begin && __isWhitespace(*(end - 1)))
+    {
+      end--;
+    }
+
+    return end;
+  }
+
+  bool IsWhitespace(std::string_view value) { return __findFirstNonWhitespace(value.data(), value.data() + value.size()) == value.data() + value.size(); }
+
+  std::string_view TrimView(std::string_view value) { return TrimLeftView(TrimRightView(value)); }
+
+  std::string_view TrimLeftView(std::string_view value)
+  {
+    value.remove_prefix(static_cast<std::size_t>(__findFirstNonWhitespace(value.data(), value.data() + value.size()) - value.data()));
+    return value;
+  }
+
+  std::string_view TrimRightView(std::string_view value)
+  {
+    return value.substr(0u, static_cast<std::size_t>(__findLastNonWhitespace(value.data(), value.data() + value.size()) - value.data()));
+  }
+
+  std::string& TrimInPlace(std::string& value) { return TrimLeftInPlace(TrimRightInPlace(value)); }
+
+  std::string& TrimLeftInPlace(std::string& value)
+  {
+    value.erase(0u, static_cast<std::size_t>(__findFirstNonWhitespace(value.data(), value.data() + value.size()) - value.data()));
+    return value;
+  }
+
+  std::string& TrimRightInPlace(std::string& value)
+  {
+    value.resize(static_cast<std::size_t>(__findLastNonWhitespace(value.data(), value.data() + value.size()) - value.data()));
+    return value;
   }
 
   std::string Trim(const std::string& value)
   {
-    auto begin = std::find_if_not(value.cbegin(), value.cend(), __isWhitespace);
-    auto end   = std::find_if_not(value.rbegin(), value.rend(), __isWhitespace);
-    return value.substr((begin != value.end()) ? std::distance(value.begin(), begin) : 0u,
-                        (end != value.rend()) ? std::distance(begin, end.base()) : std::string::npos);
+    const std::string_view result = TrimView(value);
+    return !result.empty() ? std::string(result) : value;
   }
 
   std::string TrimLeft(const std::string& value)
   {
-    auto begin = std::find_if_not(value.cbegin(), value.cend(), __isWhitespace);
-    return value.substr((begin != value.end()) ? std::distance(value.begin(), begin) : 0u, std::string::npos);
+    const std::string_view result = TrimLeftView(value);
+    return !result.empty() ? std::string(result) : value;
   }
 
   std::string TrimRight(const std::string& value)
   {
-    auto end = std::find_if_not(value.rbegin(), value.rend(), __isWhitespace);
-    return value.substr(0u, (end != value.rend()) ? std::distance(value.begin(), end.base()) : std::string::npos);
+    const std::string_view result = TrimRightView(value);
+    return !result.empty() ? std::string(result) : value;
   }
 
   std::string& Reverse(std::string& value)
@@ -184,4 +583,432 @@ namespace Text
     std::copy(value.rbegin(), value.rend(), std::back_inserter(tmpResult));
     return tmpResult;
   }
+
+  static bool __isInRange(char32_t value, char32_t first, char32_t last) { return value >= first && value <= last; }
+
+  static bool __isEvenPaired(char32_t value)
+  {
+    return __isInRange(value, 0x100u, 0x12Fu) || __isInRange(value, 0x132u, 0x137u) || __isInRange(value, 0x14Au, 0x177u) ||
+           __isInRange(value, 0x460u, 0x481u) || __isInRange(value, 0x48Au, 0x4BFu) || __isInRange(value, 0x4D0u, 0x4FFu);
+  }
+
+  static bool __isOddPaired(char32_t value)
+  {
+    return __isInRange(value, 0x139u, 0x148u) || __isInRange(value, 0x179u, 0x17Eu) || __isInRange(value, 0x4C1u, 0x4CEu);
+  }
+
+  static char32_t __toLowercase(char32_t value)
+  {
+    if((__isInRange(value, 0xC0u, 0xDEu) && value != 0xD7u) || (__isInRange(value, 0x391u, 0x3ABu) && value != 0x3A2u) || __isInRange(value, 0x410u, 0x42Fu))
+    {
+      return value + 0x20u;
+    }
+    else if(__isInRange(value, 0x400u, 0x40Fu))
+    {
+      return value + 0x50u;
+    }
+    else if(__isInRange(value, 0x388u, 0x38Au))
+    {
+      return value + 0x25u;
+    }
+    else if(__isInRange(value, 0x38Eu, 0x38Fu))
+    {
+      return value + 0x3Fu;
+    }
+    else if((__isEvenPaired(value) && (value % 2u) == 0u) || (__isOddPaired(value) && (value % 2u) != 0u))
+    {
+      return value + 1u;
+    }
+
+    switch(value)
+    {
+      case 0x178u:
+        return 0xFFu;
+      case 0x386u:
+        return 0x3ACu;
+      case 0x38Cu:
+        return 0x3CCu;
+      case 0x4C0u:
+        return 0x4CFu;
+      default:
+        return value;
+    }
+  }
+
+  static char32_t __toUppercase(char32_t value)
+  {
+    if((__isInRange(value, 0xE0u, 0xFEu) && value != 0xF7u) || (__isInRange(value, 0x3B1u, 0x3CBu) && value != 0x3C2u) || __isInRange(value, 0x430u, 0x44Fu))
+    {
+      return value - 0x20u;
+    }
+    else if(__isInRange(value, 0x450u, 0x45Fu))
+    {
+      return value - 0x50u;
+    }
+    else if(__isInRange(value, 0x3ADu, 0x3AFu))
+    {
+      return value - 0x25u;
+    }
+    else if(__isInRange(value, 0x3CDu, 0x3CEu))
+    {
+      return value - 0x3Fu;
+    }
+    else if((__isEvenPaired(value) && (value % 2u) != 0u) || (__isOddPaired(value) && (value % 2u) == 0u))
+    {
+      return value - 1u;
+    }
+
+    switch(value)
+    {
+      case 0xB5u:
+        return 0x39Cu;
+      case 0xFFu:
+        return 0x178u;
+      case 0x3ACu:
+        return 0x386u;
+      case 0x3C2u:
+        return 0x3A3u;
+      case 0x3CCu:
+        return 0x38Cu;
+      case 0x4CFu:
+        return 0x4C0u;
+      default:
+        return value;
+    }
+  }
+
+  static bool __isContinuation(const char* iter, std::size_t count)
+  {
+    return std::all_of(iter, iter + count, [](char chr) { return (static_cast<unsigned char>(chr) & 0xC0u) == 0x80u; });
+  }
+
+  static std::size_t __decodeUtf8(const char* iter, const char* end, char32_t& result)
+  {
+    const unsigned char lead = static_cast<unsigned char>(iter[0]);
+    const std::size_t length = (lead < 0x80u) ? 1u : (lead < 0xC2u) ? 0u : (lead < 0xE0u) ? 2u : (lead < 0xF0u) ? 3u : (lead < 0xF5u) ? 4u : 0u;
+    if(length == 0u || static_cast<std::size_t>(end - iter) < length || !__isContinuation(iter + 1, length - 1u))
+    {
+      return 0u;
+    }
+
+    result = (length == 1u) ? lead : (lead & (0xFFu >> (length + 1u)));
+    for(std::size_t i = 1u; i < length; i++)
+    {
+      result = (result << 6u) | (static_cast<unsigned char>(iter[i]) & 0x3Fu);
+    }
+
+    const char32_t minimum = (length == 3u) ? 0x800u : (length == 4u) ? 0x10000u : 0u;
+    return (result < minimum || result > 0x10FFFFu || __isInRange(result, 0xD800u, 0xDFFFu)) ? 0u : length;
+  }
+
+  static std::size_t __decodeUtf8(const char* begin, const char* iter, const char* end, char32_t& result)
+  {
+    const std::size_t length = __decodeUtf8(iter, end, result);
+    if(length == 0u)
+    {
+      throw std::invalid_argument("Invalid UTF-8 sequence (Index: " + std::to_string(iter - begin) + ")");
+    }
+
+    return length;
+  }
+
+#ifdef __TEXT__COMMON_SSE2__
+  static bool __isAsciiBlock(const char* iter, const char* end)
+  {
+    return end - iter >= 16 && _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(iter))) == 0;
+  }
+#endif
+
+  static void __encodeUtf8(char32_t value, const char* iter, std::size_t length, char* result)
+  {
+    if(length == 2u)
+    {
+      result[0] = static_cast<char>(0xC0u | (value >> 6u));
+      result[1] = static_cast<char>(0x80u | (value & 0x3Fu));
+    }
+    else
+    {
+      std::copy(iter, iter + length, result);
+    }
+  }
+
+  static void __toCaseUtf8(const char* begin, const char* end, char* result, char32_t (*callback)(char32_t), char first, char last)
+  {
+    const char* iter = begin;
+    while(iter != end)
+    {
+#ifdef __TEXT__COMMON_SSE2__
+      if(__isAsciiBlock(iter, end))
+      {
+        __toAsciiCaseSse2(iter, iter + 16, result, first, last);
+        continue;
+      }
+#endif
+
+      char32_t codepoint;
+      const std::size_t length = __decodeUtf8(begin, iter, end, codepoint);
+      if(length == 1u)
+      {
+        *result = __toAsciiCase(*iter, first, last);
+      }
+      else
+      {
+        __encodeUtf8(callback(codepoint), iter, length, result);
+      }
+
+      iter += length;
+      result += length;
+    }
+  }
+
+  static void __toTitleCaseUtf8(const char* begin, const char* end, char* result)
+  {
+    bool isQualifier = true;
+    const char* iter = begin;
+    while(iter != end)
+    {
+#ifdef __TEXT__COMMON_SSE2__
+      if(__isAsciiBlock(iter, end))
+      {
+        __toTitleCaseSse2(iter, iter + 16, result, isQualifier);
+        continue;
+      }
+#endif
+
+      char32_t codepoint;
+      const std::size_t length = __decodeUtf8(begin, iter, end, codepoint);
+      if(length == 1u)
+      {
+        *result = __toTitleCase(*iter, isQualifier);
+      }
+      else
+      {
+        __encodeUtf8(isQualifier ? __toUppercase(codepoint) : __toLowercase(codepoint), iter, length, result);
+        isQualifier = false;
+      }
+
+      iter += length;
+      result += length;
+    }
+  }
+
+  bool IsValidUtf8(std::string_view value)
+  {
+    const char* iter = value.data();
+    const char* end  = iter + value.size();
+    while(iter != end)
+    {
+#ifdef __TEXT__COMMON_SSE2__
+      if(__isAsciiBlock(iter, end))
+      {
+        iter += 16;
+        continue;
+      }
+#endif
+
+      char32_t codepoint;
+      const std::size_t length = __decodeUtf8(iter, end, codepoint);
+      if(length == 0u)
+      {
+        return false;
+      }
+
+      iter += length;
+    }
+
+    return true;
+  }
+
+  static void __validateUtf8(std::string_view value)
+  {
+    if(!IsValidUtf8(value))
+    {
+      throw std::invalid_argument("Invalid UTF-8 sequence");
+    }
+  }
+
+  std::string& ToLowercaseUtf8(std::string& value)
+  {
+    __validateUtf8(value);
+    __toCaseUtf8(value.data(), value.data() + value.size(), value.data(), __toLowercase, 'A', 'Z');
+    return value;
+  }
+
+  std::string& ToUppercaseUtf8(std::string& value)
+  {
+    __validateUtf8(value);
+    __toCaseUtf8(value.data(), value.data() + value.size(), value.data(), __toUppercase, 'a', 'z');
+    return value;
+  }
+
+  std::string& ToTitleCaseUtf8(std::string& value)
+  {
+    __validateUtf8(value);
+    __toTitleCaseUtf8(value.data(), value.data() + value.size(), value.data());
+    return value;
+  }
+
+  std::string& ReverseUtf8(std::string& value)
+  {
+    __validateUtf8(value);
+
+    Reverse(value);
+
+    char* iter = value.data();
+    char* end  = iter + value.size();
+    while(iter != end)
+    {
+#ifdef __TEXT__COMMON_SSE2__
+      if(__isAsciiBlock(iter, end))
+      {
+        iter += 16;
+        continue;
+      }
+#endif
+
+      char* last = iter;
+      while((static_cast<unsigned char>(*last) & 0xC0u) == 0x80u)
+      {
+        last++;
+      }
+
+      std::reverse(iter, last + 1);
+      iter = last + 1;
+    }
+
+    return value;
+  }
+
+  std::string ToLowercaseUtf8Copy(const std::string& value)
+  {
+    std::string result(value.size(), '\0');
+    __toCaseUtf8(value.data(), value.data() + value.size(), result.data(), __toLowercase, 'A', 'Z');
+    return result;
+  }
+
+  std::string ToUppercaseUtf8Copy(const std::string& value)
+  {
+    std::string result(value.size(), '\0');
+    __toCaseUtf8(value.data(), value.data() + value.size(), result.data(), __toUppercase, 'a', 'z');
+    return result;
+  }
+
+  std::string ToTitleCaseUtf8Copy(const std::string& value)
+  {
+    std::string result(value.size(), '\0');
+    __toTitleCaseUtf8(value.data(), value.data() + value.size(), result.data());
+    return result;
+  }
+
+  std::string ReverseUtf8Copy(const std::string& value)
+  {
+    std::string result = value;
+    return ReverseUtf8(result);
+  }
+
+  Splitter Split(std::string_view value, char delimiter) { return Splitter(value, delimiter); }
+
+  Splitter Split(std::string_view value, std::string_view delimiter) { return Splitter(value, delimiter, Splitter::Mode::String); }
+
+  Splitter SplitAny(std::string_view value, std::string_view delimiters) { return Splitter(value, delimiters, Splitter::Mode::CharacterSet); }
+
+  static std::size_t __getRowGrainSize(const StringColumn& values, ThreadPool& pool)
+  {
+    const std::size_t averageSize = std::max(values.GetBytes().size() / std::max(values.GetSize(), std::size_t(1u)), std::size_t(1u));
+    return std::max(pool.GetGrainSize() / averageSize, std::size_t(1u));
+  }
+
+  static StringColumn __toAsciiCaseCopy(const StringColumn& values, ThreadPool& pool, char first, char last)
+  {
+    const std::string& bytes = values.GetBytes();
+    std::string result(bytes.size(), '\0');
+    pool.ParallelFor(bytes.size(), [&bytes, &result, first, last](std::size_t begin, std::size_t end) {
+      __toAsciiCase(bytes.data() + begin, bytes.data() + end, result.data() + begin, first, last);
+    });
+
+    return StringColumn(std::move(result), std::vector<std::size_t>(values.GetOffsets()));
+  }
+
+  std::string& ToLowercase(std::string& value, ThreadPool& pool)
+  {
+    pool.ParallelFor(value.size(), [&value](std::size_t begin, std::size_t end) {
+      __toAsciiCase(value.data() + begin, value.data() + end, value.data() + begin, 'A', 'Z');
+    });
+
+    return value;
+  }
+
+  std::string& ToUppercase(std::string& value, ThreadPool& pool)
+  {
+    pool.ParallelFor(value.size(), [&value](std::size_t begin, std::size_t end) {
+      __toAsciiCase(value.data() + begin, value.data() + end, value.data() + begin, 'a', 'z');
+    });
+
+    return value;
+  }
+
+  std::string& Reverse(std::string& value, ThreadPool& pool)
+  {
+    pool.ParallelFor(value.size() / 2u, pool.GetGrainSize() / 2u, [&value](std::size_t begin, std::size_t end) {
+      std::swap_ranges(value.begin() + static_cast<std::ptrdiff_t>(begin),
+                       value.begin() + static_cast<std::ptrdiff_t>(end),
+                       value.rbegin() + static_cast<std::ptrdiff_t>(begin));
+    });
+
+    return value;
+  }
+
+  StringColumn ToLowercaseCopy(const StringColumn& values, ThreadPool& pool) { return __toAsciiCaseCopy(values, pool, 'A', 'Z'); }
+
+  StringColumn ToUppercaseCopy(const StringColumn& values, ThreadPool& pool) { return __toAsciiCaseCopy(values, pool, 'a', 'z'); }
+
+  StringColumn Trim(const StringColumn& values, ThreadPool& pool)
+  {
+    std::vector<std::string_view> views(values.GetSize());
+    pool.ParallelFor(values.GetSize(), __getRowGrainSize(values, pool), [&values, &views](std::size_t begin, std::size_t end) {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        const std::string_view value = TrimView(values[i]);
+        views[i]                     = !value.empty() ? value : values[i];
+      }
+    });
+
+    std::vector<std::size_t> offsets(values.GetSize() + 1u, 0u);
+    for(std::size_t i = 0u; i < views.size(); i++)
+    {
+      offsets[i + 1u] = offsets[i] + views[i].size();
+    }
+
+    std::string result(offsets.back(), '\0');
+    pool.ParallelFor(values.GetSize(), __getRowGrainSize(values, pool), [&views, &offsets, &result](std::size_t begin, std::size_t end) {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        std::copy(views[i].cbegin(), views[i].cend(), result.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+      }
+    });
+
+    return StringColumn(std::move(result), std::move(offsets));
+  }
+
+  StringColumn ReverseCopy(const StringColumn& values, ThreadPool& pool)
+  {
+    std::string result(values.GetBytes().size(), '\0');
+    pool.ParallelFor(values.GetSize(), __getRowGrainSize(values, pool), [&values, &result](std::size_t begin, std::size_t end) {
+      for(std::size_t i = begin; i < end; i++)
+      {
+        const std::string_view value = values[i];
+        std::reverse_copy(value.cbegin(), value.cend(), result.begin() + static_cast<std::ptrdiff_t>(values.GetOffsets()[i]));
+      }
+    });
+
+    return StringColumn(std::move(result), std::vector<std::size_t>(values.GetOffsets()));
+  }
+
+  StringColumn ToLowercaseCopy(const StringColumn& values) { return ToLowercaseCopy(values, ThreadPool::GetDefault()); }
+
+  StringColumn ToUppercaseCopy(const StringColumn& values) { return ToUppercaseCopy(values, ThreadPool::GetDefault()); }
+
+  StringColumn Trim(const StringColumn& values) { return Trim(values, ThreadPool::GetDefault()); }
+
+  StringColumn ReverseCopy(const StringColumn& values) { return ReverseCopy(values, ThreadPool::GetDefault()); }
 } // namespace Text
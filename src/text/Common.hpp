@@ -1,14 +1,123 @@
 #ifndef __TEXT__COMMON_HPP__
 #define __TEXT__COMMON_HPP__
 
+#include "Splitter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
 
 namespace Text
 {
-  bool IsWhitespace(const std::string& value);
-  bool CompareIgnoreCase(const std::string& a, const std::string& b);
+  class StringColumn;
+  class ThreadPool;
+
+  bool IsWhitespace(std::string_view value);
+  bool CompareIgnoreCase(std::string_view a, std::string_view b);
+  std::size_t HashString(std::string_view value);
+  std::size_t HashIgnoreCase(std::string_view value);
+  std::size_t EditDistance(std::string_view a, std::string_view b);
+
+  struct StringHash
+  {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view value) const;
+  };
+
+  struct CaseInsensitiveHash
+  {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view value) const;
+  };
+
+  struct CaseInsensitiveEqual
+  {
+    using is_transparent = void;
+
+    bool operator()(std::string_view a, std::string_view b) const;
+  };
+
+  template<class T>
+  class StringMapView
+  {
+    public:
+    using MapType       = std::unordered_map<std::string, T, StringHash>;
+    using LegacyMapType = std::unordered_map<std::string, T>;
+
+    const T* Find(const std::string& key) const
+    {
+      if(m_pMap != nullptr)
+      {
+        const auto iter = m_pMap->find(key);
+        return iter != m_pMap->cend() ? &iter->second : nullptr;
+      }
+      else if(m_pLegacyMap != nullptr)
+      {
+        const auto iter = m_pLegacyMap->find(key);
+        return iter != m_pLegacyMap->cend() ? &iter->second : nullptr;
+      }
+
+      return nullptr;
+    }
+
+    template<class Function>
+    void ForEach(Function function) const
+    {
+      if(m_pMap != nullptr)
+      {
+        for(const auto& i : *m_pMap)
+        {
+          function(i.first, i.second);
+        }
+      }
+      else if(m_pLegacyMap != nullptr)
+      {
+        for(const auto& i : *m_pLegacyMap)
+        {
+          function(i.first, i.second);
+        }
+      }
+    }
+
+    bool operator==(std::nullptr_t) const { return m_pMap == nullptr && m_pLegacyMap == nullptr; }
+    bool operator!=(std::nullptr_t) const { return m_pMap != nullptr || m_pLegacyMap != nullptr; }
+
+    StringMapView(const StringMapView::MapType* value)
+        : m_pMap(value)
+        , m_pLegacyMap(nullptr)
+    {}
+
+    StringMapView(const StringMapView::LegacyMapType* value)
+        : m_pMap(nullptr)
+        , m_pLegacyMap(value)
+    {}
+
+    StringMapView(std::nullptr_t)
+        : m_pMap(nullptr)
+        , m_pLegacyMap(nullptr)
+    {}
+
+    StringMapView()
+        : m_pMap(nullptr)
+        , m_pLegacyMap(nullptr)
+    {}
+
+    private:
+    const StringMapView::MapType* m_pMap;
+    const StringMapView::LegacyMapType* m_pLegacyMap;
+  };
 
   std::string& ToLowercase(std::string& value);
   std::string& ToUppercase(std::string& value);
@@ -24,16 +133,140 @@ namespace Text
   std::string TrimLeft(const std::string& value);
   std::string TrimRight(const std::string& value);
 
+  std::string_view TrimView(std::string_view value);
+  std::string_view TrimLeftView(std::string_view value);
+  std::string_view TrimRightView(std::string_view value);
+
+  std::string& TrimInPlace(std::string& value);
+  std::string& TrimLeftInPlace(std::string& value);
+  std::string& TrimRightInPlace(std::string& value);
+
   std::string& Reverse(std::string& value);
   std::string ReverseCopy(const std::string& value);
 
+  bool IsValidUtf8(std::string_view value);
+
+  std::string& ToLowercaseUtf8(std::string& value);
+  std::string& ToUppercaseUtf8(std::string& value);
+  std::string& ToTitleCaseUtf8(std::string& value);
+  std::string& ReverseUtf8(std::string& value);
+
+  std::string ToLowercaseUtf8Copy(const std::string& value);
+  std::string ToUppercaseUtf8Copy(const std::string& value);
+  std::string ToTitleCaseUtf8Copy(const std::string& value);
+  std::string ReverseUtf8Copy(const std::string& value);
+
+  std::string& ToLowercase(std::string& value, ThreadPool& pool);
+  std::string& ToUppercase(std::string& value, ThreadPool& pool);
+  std::string& Reverse(std::string& value, ThreadPool& pool);
+
+  StringColumn ToLowercaseCopy(const StringColumn& values, ThreadPool& pool);
+  StringColumn ToUppercaseCopy(const StringColumn& values, ThreadPool& pool);
+  StringColumn Trim(const StringColumn& values, ThreadPool& pool);
+  StringColumn ReverseCopy(const StringColumn& values, ThreadPool& pool);
+
+  StringColumn ToLowercaseCopy(const StringColumn& values);
+  StringColumn ToUppercaseCopy(const StringColumn& values);
+  StringColumn Trim(const StringColumn& values);
+  StringColumn ReverseCopy(const StringColumn& values);
+
+  Splitter Split(std::string_view value, char delimiter);
+  Splitter Split(std::string_view value, std::string_view delimiter);
+  Splitter SplitAny(std::string_view value, std::string_view delimiters);
+
+  template<class Iterator>
+  std::string Join(Iterator begin, Iterator end, std::string_view separator)
+  {
+    std::size_t size = 0u;
+    for(Iterator iter = begin; iter != end; ++iter)
+    {
+      size += std::string_view(*iter).size() + ((iter != begin) ? separator.size() : 0u);
+    }
+
+    std::string result;
+    result.reserve(size);
+    for(Iterator iter = begin; iter != end; ++iter)
+    {
+      if(iter != begin)
+      {
+        result.append(separator);
+      }
+
+      result.append(std::string_view(*iter));
+    }
+
+    return result;
+  }
+
+  template<class Range>
+  std::string Join(const Range& values, std::string_view separator)
+  {
+    return Join(std::begin(values), std::end(values), separator);
+  }
+
+  template<class T>
+  constexpr bool IsCharConvertible = std::is_floating_point_v<T> ||
+                                     (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> && !std::is_same_v<T, signed char> &&
+                                      !std::is_same_v<T, unsigned char> && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> &&
+                                      !std::is_same_v<T, char32_t>);
+
+  template<class T>
+  bool TryToString(const T& value, std::string& result);
+
+  template<class T>
+  bool TryToString(const T& value, char* result, std::size_t size, std::size_t& length)
+  {
+    if constexpr(IsCharConvertible<T>)
+    {
+      std::to_chars_result tmpResult;
+      if constexpr(std::is_floating_point_v<T>)
+      {
+        tmpResult = std::to_chars(result, result + size, value, std::chars_format::general, 6);
+      }
+      else
+      {
+        tmpResult = std::to_chars(result, result + size, value);
+      }
+
+      length = static_cast<std::size_t>(tmpResult.ptr - result);
+      return tmpResult.ec == std::errc();
+    }
+    else
+    {
+      std::string tmpResult;
+      if(!TryToString(value, tmpResult) || tmpResult.size() > size)
+      {
+        return false;
+      }
+
+      std::copy(tmpResult.cbegin(), tmpResult.cend(), result);
+      length = tmpResult.size();
+      return true;
+    }
+  }
+
   template<class T>
   bool TryToString(const T& value, std::string& result)
   {
-    std::ostringstream oss;
-    oss << value;
-    result = oss.str();
-    return oss.good() || oss.eof();
+    if constexpr(IsCharConvertible<T>)
+    {
+      std::array<char, 64u> buffer;
+      std::size_t length;
+      if(!TryToString(value, buffer.data(), buffer.size(), length))
+      {
+        return false;
+      }
+
+      result.assign(buffer.data(), length);
+      return true;
+    }
+    else
+    {
+      std::ostringstream oss;
+      oss << value;
+      result = oss.str();
+      return oss.good() || oss.eof();
+    }
   }
 
   template<class T>
@@ -49,15 +282,37 @@ namespace Text
   }
 
   template<class T>
-  bool TryFromString(const std::string& value, T& result)
+  bool TryFromString(std::string_view value, T& result)
   {
-    std::istringstream iss(value);
+    if constexpr(IsCharConvertible<T>)
+    {
+      T tmpResult;
+      const std::from_chars_result status = std::from_chars(value.data(), value.data() + value.size(), tmpResult);
+      if constexpr(std::is_floating_point_v<T>)
+      {
+        if(status.ec == std::errc() && std::isfinite(tmpResult))
+        {
+          result = tmpResult;
+          return true;
+        }
+      }
+      else
+      {
+        if(status.ec == std::errc())
+        {
+          result = tmpResult;
+          return true;
+        }
+      }
+    }
+
+    std::istringstream iss {std::string(value)};
     iss >> result;
     return iss.good() || iss.eof();
   }
 
   template<class T>
-  T FromString(const std::string& value)
+  T FromString(std::string_view value)
   {
     T tmpResult;
     if(!TryFromString(value, tmpResult))
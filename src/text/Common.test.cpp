@@ -1,4 +1,15 @@
 #include "Common.hpp"
+#include "StringColumn.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -40,6 +51,103 @@ namespace UnitTest
     ASSERT_FALSE(Text::CompareIgnoreCase("ABC 123", "ABC"));
     ASSERT_FALSE(Text::CompareIgnoreCase("Abc", "aBC 123"));
     ASSERT_FALSE(Text::CompareIgnoreCase("Abc 123", "aBC"));
+
+    const std::string value = "The Quick Brown Fox Jumps Over The Lazy Dog [@`{] 0123456789";
+    for(std::size_t i = 0u; i < value.size(); i++)
+    {
+      std::string tmpValue = Text::ToUppercaseCopy(value);
+      ASSERT_TRUE(Text::CompareIgnoreCase(value.substr(i), tmpValue.substr(i)));
+
+      tmpValue[i] = '#';
+      ASSERT_FALSE(Text::CompareIgnoreCase(value, tmpValue));
+    }
+  }
+
+  TEST(Common, HashString)
+  {
+    const std::string value = "math.log2";
+    ASSERT_EQ(Text::HashString(value), Text::HashString(std::string_view(value)));
+    ASSERT_EQ(Text::HashString(value), Text::StringHash()(value));
+    ASSERT_NE(Text::HashString("math.log2"), Text::HashString("math.Log2"));
+    ASSERT_NE(Text::HashString(""), Text::HashString(std::string(1u, '\0')));
+
+    std::unordered_set<std::size_t> hashes;
+    for(std::size_t i = 0u; i < 100000u; i++)
+    {
+      const std::string key = "module" + std::to_string(i % 100u) + ".function" + std::string(i % 48u, '_') + std::to_string(i);
+      ASSERT_EQ(Text::HashString(key), Text::HashString(key));
+      hashes.insert(Text::HashString(key));
+    }
+
+    ASSERT_EQ(hashes.size(), 100000u);
+
+    std::unordered_map<std::string, int, Text::StringHash> map;
+    map["math.log2"] = 1;
+    ASSERT_EQ(map.at("math.log2"), 1);
+  }
+
+  TEST(Common, HashIgnoreCase)
+  {
+    const std::string value = "The Quick Brown Fox Jumps Over The Lazy Dog [@`{] 0123456789";
+    for(std::size_t i = 0u; i < value.size(); i++)
+    {
+      ASSERT_EQ(Text::HashIgnoreCase(value.substr(i)), Text::HashIgnoreCase(Text::ToUppercaseCopy(value.substr(i))));
+      ASSERT_EQ(Text::HashIgnoreCase(value.substr(i)), Text::HashIgnoreCase(Text::ToLowercaseCopy(value.substr(i))));
+    }
+
+    ASSERT_NE(Text::HashIgnoreCase("abc"), Text::HashIgnoreCase("abd"));
+    ASSERT_NE(Text::HashIgnoreCase("abc"), Text::HashIgnoreCase("abc "));
+    ASSERT_NE(Text::HashIgnoreCase("@"), Text::HashIgnoreCase("`"));
+
+    std::unordered_map<std::string, int, Text::CaseInsensitiveHash, Text::CaseInsensitiveEqual> map;
+    map["Abc"] = 1;
+    map["ABC"] = 2;
+    map["def"] = 3;
+    ASSERT_EQ(map.size(), 2u);
+    ASSERT_EQ(map.at("abc"), 2);
+    ASSERT_EQ(map.at("DEF"), 3);
+    ASSERT_EQ(map.count("abc "), 0u);
+  }
+
+  TEST(Common, EditDistance)
+  {
+    ASSERT_EQ(Text::EditDistance("", ""), 0u);
+    ASSERT_EQ(Text::EditDistance("", "abc"), 3u);
+    ASSERT_EQ(Text::EditDistance("abc", ""), 3u);
+    ASSERT_EQ(Text::EditDistance("abc", "abc"), 0u);
+    ASSERT_EQ(Text::EditDistance("kitten", "sitting"), 3u);
+    ASSERT_EQ(Text::EditDistance("flaw", "lawn"), 2u);
+    ASSERT_EQ(Text::EditDistance("list", "lsit"), 2u);
+    ASSERT_EQ(Text::EditDistance("system.list", "system.lsit"), 2u);
+    ASSERT_EQ(Text::EditDistance("aaa", "aaaaa"), 2u);
+    ASSERT_EQ(Text::EditDistance("abab", "ab"), 2u);
+
+    const auto naive = [](const std::string& a, const std::string& b) {
+      std::vector<std::vector<std::size_t>> distances(a.size() + 1u, std::vector<std::size_t>(b.size() + 1u, 0u));
+      for(std::size_t i = 0u; i <= a.size(); i++)
+      {
+        for(std::size_t j = 0u; j <= b.size(); j++)
+        {
+          distances[i][j] = (i == 0u || j == 0u) ? i + j
+                                                 : std::min({distances[i - 1u][j] + 1u,
+                                                             distances[i][j - 1u] + 1u,
+                                                             distances[i - 1u][j - 1u] + ((a[i - 1u] != b[j - 1u]) ? 1u : 0u)});
+        }
+      }
+
+      return distances[a.size()][b.size()];
+    };
+
+    std::string a;
+    std::string b;
+    for(std::size_t i = 0u; i < 150u; i++)
+    {
+      a.push_back(static_cast<char>('a' + (i * 7u) % 5u));
+      b.push_back(static_cast<char>('a' + (i * 3u) % 4u));
+      ASSERT_EQ(Text::EditDistance(a, b), naive(a, b));
+      ASSERT_EQ(Text::EditDistance(a, b.substr(i / 2u)), naive(a, b.substr(i / 2u)));
+      ASSERT_EQ(Text::EditDistance(a, a.substr(0u, i / 3u) + b + a.substr(i / 2u)), naive(a, a.substr(0u, i / 3u) + b + a.substr(i / 2u)));
+    }
   }
 
   TEST(Common, ToLowercase)
@@ -210,6 +318,21 @@ namespace UnitTest
     ASSERT_EQ(Text::ToLowercaseCopy("ABC 123"), "abc 123");
     ASSERT_EQ(Text::ToLowercaseCopy("Abc 123"), "abc 123");
     ASSERT_EQ(Text::ToLowercaseCopy("aBC 123"), "abc 123");
+
+    std::string value;
+    for(int i = 0; i < 1000; i++)
+    {
+      value.push_back(static_cast<char>(i % 256));
+    }
+
+    std::string expected = value;
+    std::transform(expected.begin(), expected.end(), expected.begin(), [](char chr) {
+      return static_cast<char>(std::tolower(static_cast<unsigned char>(chr)));
+    });
+    for(std::size_t i = 0u; i < 40u; i++)
+    {
+      ASSERT_EQ(Text::ToLowercaseCopy(value.substr(i, i * 7u)), expected.substr(i, i * 7u));
+    }
   }
 
   TEST(Common, ToUppercaseCopy)
@@ -220,6 +343,21 @@ namespace UnitTest
     ASSERT_EQ(Text::ToUppercaseCopy("ABC 123"), "ABC 123");
     ASSERT_EQ(Text::ToUppercaseCopy("Abc 123"), "ABC 123");
     ASSERT_EQ(Text::ToUppercaseCopy("aBC 123"), "ABC 123");
+
+    std::string value;
+    for(int i = 0; i < 1000; i++)
+    {
+      value.push_back(static_cast<char>(i % 256));
+    }
+
+    std::string expected = value;
+    std::transform(expected.begin(), expected.end(), expected.begin(), [](char chr) {
+      return static_cast<char>(std::toupper(static_cast<unsigned char>(chr)));
+    });
+    for(std::size_t i = 0u; i < 40u; i++)
+    {
+      ASSERT_EQ(Text::ToUppercaseCopy(value.substr(i, i * 7u)), expected.substr(i, i * 7u));
+    }
   }
 
   TEST(Common, ToTitleCaseCopy)
@@ -236,6 +374,26 @@ namespace UnitTest
     ASSERT_EQ(Text::ToTitleCaseCopy("ABC DEF 123. GHI, JKL 123"), "Abc Def 123. Ghi, Jkl 123");
     ASSERT_EQ(Text::ToTitleCaseCopy("Abc Def 123. Ghi, Jkl 123"), "Abc Def 123. Ghi, Jkl 123");
     ASSERT_EQ(Text::ToTitleCaseCopy("aBC dEF 123. gHI, jKL 123"), "Abc Def 123. Ghi, Jkl 123");
+
+    const std::string words = "aBc dE,f.G h\t\n;I . j 1k\xC3\xA9";
+    std::string value;
+    for(std::size_t i = 0u; i < 1000u; i++)
+    {
+      value.push_back(words[(i * 7u + i / 13u) % words.size()]);
+    }
+
+    for(std::size_t i = 0u; i < 40u; i++)
+    {
+      const std::string tmpValue = value.substr(i, i * 7u);
+      std::string expected;
+      bool isQualifier = true;
+      std::transform(tmpValue.begin(), tmpValue.end(), std::back_inserter(expected), [&isQualifier](char chr) {
+        const char tmpResult = static_cast<char>(isQualifier ? std::toupper(chr) : std::tolower(chr));
+        isQualifier          = (std::isspace(chr) != 0) || (std::ispunct(chr) != 0);
+        return tmpResult;
+      });
+      ASSERT_EQ(Text::ToTitleCaseCopy(tmpValue), expected);
+    }
   }
 
   TEST(Common, ToSentenceCaseCopy)
@@ -252,6 +410,32 @@ namespace UnitTest
     ASSERT_EQ(Text::ToSentenceCaseCopy("ABC DEF 123. GHI, JKL 123"), "Abc def 123. Ghi, jkl 123");
     ASSERT_EQ(Text::ToSentenceCaseCopy("Abc Def 123. Ghi, Jkl 123"), "Abc def 123. Ghi, jkl 123");
     ASSERT_EQ(Text::ToSentenceCaseCopy("aBC dEF 123. gHI, jKL 123"), "Abc def 123. Ghi, jkl 123");
+
+    const std::string words = "aBc dE,f.G h\t\n;I . j 1k\xC3\xA9";
+    std::string value;
+    for(std::size_t i = 0u; i < 1000u; i++)
+    {
+      value.push_back(words[(i * 7u + i / 13u) % words.size()]);
+    }
+
+    for(std::size_t i = 0u; i < 40u; i++)
+    {
+      const std::string tmpValue = value.substr(i, i * 7u);
+      std::string expected;
+      bool isQualifier = true;
+      std::transform(tmpValue.begin(), tmpValue.end(), std::back_inserter(expected), [&isQualifier](char chr) {
+        if(std::isalpha(chr) != 0)
+        {
+          const char tmpResult = static_cast<char>(isQualifier ? std::toupper(chr) : std::tolower(chr));
+          isQualifier          = false;
+          return tmpResult;
+        }
+
+        isQualifier = isQualifier || chr == '.';
+        return chr;
+      });
+      ASSERT_EQ(Text::ToSentenceCaseCopy(tmpValue), expected);
+    }
   }
 
   TEST(Common, Trim)
@@ -266,6 +450,7 @@ namespace UnitTest
     ASSERT_EQ(Text::Trim("abc 123 "), "abc 123");
     ASSERT_EQ(Text::Trim(" abc 123 "), "abc 123");
     ASSERT_EQ(Text::Trim(" \t\v\n\r\fabc \t\v\n\r\f123 \t\v\n\r\f"), "abc \t\v\n\r\f123");
+    ASSERT_EQ(Text::Trim(" \t\n "), " \t\n ");
   }
 
   TEST(Common, TrimLeft)
@@ -280,6 +465,7 @@ namespace UnitTest
     ASSERT_EQ(Text::TrimLeft("abc 123 "), "abc 123 ");
     ASSERT_EQ(Text::TrimLeft(" abc 123 "), "abc 123 ");
     ASSERT_EQ(Text::TrimLeft(" \t\v\n\r\fabc \t\v\n\r\f123 \t\v\n\r\f"), "abc \t\v\n\r\f123 \t\v\n\r\f");
+    ASSERT_EQ(Text::TrimLeft(" \t\n "), " \t\n ");
   }
 
   TEST(Common, TrimRight)
@@ -294,6 +480,52 @@ namespace UnitTest
     ASSERT_EQ(Text::TrimRight("abc 123 "), "abc 123");
     ASSERT_EQ(Text::TrimRight(" abc 123 "), " abc 123");
     ASSERT_EQ(Text::TrimRight(" \t\v\n\r\fabc \t\v\n\r\f123 \t\v\n\r\f"), " \t\v\n\r\fabc \t\v\n\r\f123");
+    ASSERT_EQ(Text::TrimRight(" \t\n "), " \t\n ");
+  }
+
+  TEST(Common, TrimView)
+  {
+    const std::string value = " \t\v\n\r\fabc \t\v\n\r\f123 \t\v\n\r\f";
+    ASSERT_EQ(Text::TrimView(value), "abc \t\v\n\r\f123");
+    ASSERT_EQ(Text::TrimLeftView(value), "abc \t\v\n\r\f123 \t\v\n\r\f");
+    ASSERT_EQ(Text::TrimRightView(value), " \t\v\n\r\fabc \t\v\n\r\f123");
+    ASSERT_EQ(Text::TrimView(value).data(), value.data() + 6);
+
+    ASSERT_EQ(Text::TrimView(""), "");
+    ASSERT_EQ(Text::TrimView(" \t\v\n\r\f"), "");
+    ASSERT_EQ(Text::TrimLeftView(" \t\v\n\r\f"), "");
+    ASSERT_EQ(Text::TrimRightView(" \t\v\n\r\f"), "");
+
+    for(std::size_t i = 0u; i < 40u; i++)
+    {
+      const std::string padding(i, ' ');
+      const std::string text = "abc" + padding + "123";
+      ASSERT_EQ(Text::TrimView(padding + "\t" + text + "\n" + padding), text);
+      ASSERT_EQ(Text::TrimLeftView(padding + text + padding), text + padding);
+      ASSERT_EQ(Text::TrimRightView(padding + text + padding), padding + text);
+      ASSERT_TRUE(Text::IsWhitespace(padding + "\t"));
+      ASSERT_FALSE(Text::IsWhitespace(padding + "\xA0" + padding));
+    }
+  }
+
+  TEST(Common, TrimInPlace)
+  {
+    {
+      std::string value = " \t\v\n\r\fabc \t\v\n\r\f123 \t\v\n\r\f";
+      ASSERT_EQ(Text::TrimInPlace(value), "abc \t\v\n\r\f123");
+    }
+    {
+      std::string value = " \t\v\n\r\fabc \t\v\n\r\f123 \t\v\n\r\f";
+      ASSERT_EQ(Text::TrimLeftInPlace(value), "abc \t\v\n\r\f123 \t\v\n\r\f");
+    }
+    {
+      std::string value = " \t\v\n\r\fabc \t\v\n\r\f123 \t\v\n\r\f";
+      ASSERT_EQ(Text::TrimRightInPlace(value), " \t\v\n\r\fabc \t\v\n\r\f123");
+    }
+    {
+      std::string value = "  ";
+      ASSERT_EQ(Text::TrimInPlace(value), "");
+    }
   }
 
   TEST(Common, Reverse)
@@ -334,12 +566,188 @@ namespace UnitTest
     }
   }
 
+  TEST(Common, Utf8)
+  {
+    ASSERT_TRUE(Text::IsValidUtf8(""));
+    ASSERT_TRUE(Text::IsValidUtf8("abc \xC3\xA9 \xE2\x82\xAC \xF0\x9F\x98\x80"));
+    ASSERT_FALSE(Text::IsValidUtf8("\xC3"));
+    ASSERT_FALSE(Text::IsValidUtf8("\xC0\xAF"));
+    ASSERT_FALSE(Text::IsValidUtf8("\xED\xA0\x80"));
+    ASSERT_FALSE(Text::IsValidUtf8("\xF4\x90\x80\x80"));
+    ASSERT_FALSE(Text::IsValidUtf8("\x80" "abc"));
+
+    ASSERT_EQ(Text::ToLowercaseUtf8Copy("ÀÉÎÕÜ ÆØÅ Ÿ ĀĹŊŽ ΑΣΩ ΆΈΌΏ АЯЁЄ Ѡ Ӂ Ӑ ß × 123 ABC"), "àéîõü æøå ÿ āĺŋž ασω άέόώ аяёє ѡ ӂ ӑ ß × 123 abc");
+    ASSERT_EQ(Text::ToUppercaseUtf8Copy("àéîõü æøå ÿ āĺŋž ασω άέόώ аяёє ѡ ӂ ӑ ß ÷ 123 abc"), "ÀÉÎÕÜ ÆØÅ Ÿ ĀĹŊŽ ΑΣΩ ΆΈΌΏ АЯЁЄ Ѡ Ӂ Ӑ ß ÷ 123 ABC");
+    ASSERT_EQ(Text::ToUppercaseUtf8Copy("µ ς ı ſ"), "Μ Σ ı ſ");
+    ASSERT_EQ(Text::ToLowercaseUtf8Copy("İ € 😀"), "İ € 😀");
+    ASSERT_EQ(Text::ToTitleCaseUtf8Copy("élan vital, ÉCOLE normale. жизнь-ПРЕКРАСНА"), "Élan Vital, École Normale. Жизнь-Прекрасна");
+    ASSERT_EQ(Text::ReverseUtf8Copy("abc é € 😀"), "😀 € é cba");
+
+    std::string value = "ÉCOLE NORMALE SUPÉRIEURE, PARIS";
+    ASSERT_EQ(Text::ToLowercaseUtf8(value), "école normale supérieure, paris");
+    ASSERT_EQ(Text::ToUppercaseUtf8(value), "ÉCOLE NORMALE SUPÉRIEURE, PARIS");
+    ASSERT_EQ(Text::ToTitleCaseUtf8(value), "École Normale Supérieure, Paris");
+    ASSERT_EQ(Text::ReverseUtf8(value), "siraP ,erueirépuS elamroN elocÉ");
+
+    value = "ABC def \xC3";
+    ASSERT_THROW(Text::ToLowercaseUtf8(value), std::invalid_argument);
+    ASSERT_THROW(Text::ToUppercaseUtf8(value), std::invalid_argument);
+    ASSERT_THROW(Text::ToTitleCaseUtf8(value), std::invalid_argument);
+    ASSERT_THROW(Text::ReverseUtf8(value), std::invalid_argument);
+    ASSERT_EQ(value, "ABC def \xC3");
+
+    std::string ascii;
+    for(int i = 0; i < 1000; i++)
+    {
+      ascii.push_back(static_cast<char>(i % 128));
+    }
+
+    for(std::size_t i = 0u; i < 40u; i++)
+    {
+      const std::string tmpValue = ascii.substr(i, i * 7u) + "Ä" + ascii.substr(i, i * 3u);
+      ASSERT_EQ(Text::ToLowercaseUtf8Copy(tmpValue), Text::ToLowercaseCopy(ascii.substr(i, i * 7u)) + "ä" + Text::ToLowercaseCopy(ascii.substr(i, i * 3u)));
+      std::string expected = Text::ToTitleCaseCopy(ascii.substr(i, i * 7u) + "A" + ascii.substr(i, i * 3u));
+      expected.replace(i * 7u, 1u, (expected[i * 7u] == 'A') ? "Ä" : "ä");
+      ASSERT_EQ(Text::ToTitleCaseUtf8Copy(tmpValue), expected);
+      ASSERT_EQ(Text::ReverseUtf8Copy(tmpValue), Text::ReverseCopy(ascii.substr(i, i * 3u)) + "Ä" + Text::ReverseCopy(ascii.substr(i, i * 7u)));
+    }
+  }
+
+  TEST(Common, Split)
+  {
+    using Pieces = std::vector<std::string_view>;
+
+    ASSERT_EQ(Text::Split("", ',').ToVector(), (Pieces {""}));
+    ASSERT_EQ(Text::Split("abc", ',').ToVector(), (Pieces {"abc"}));
+    ASSERT_EQ(Text::Split("abc,123", ',').ToVector(), (Pieces {"abc", "123"}));
+    ASSERT_EQ(Text::Split(",abc,,123,", ',').ToVector(), (Pieces {"", "abc", "", "123", ""}));
+
+    ASSERT_EQ(Text::Split("abc::123::", "::").ToVector(), (Pieces {"abc", "123", ""}));
+    ASSERT_EQ(Text::Split("abc:123", "::").ToVector(), (Pieces {"abc:123"}));
+    ASSERT_EQ(Text::Split(":::", "::").ToVector(), (Pieces {"", ":"}));
+    ASSERT_THROW(Text::Split("abc", ""), std::invalid_argument);
+
+    ASSERT_EQ(Text::SplitAny("abc,123;def", ",;").ToVector(), (Pieces {"abc", "123", "def"}));
+    ASSERT_EQ(Text::SplitAny("abc 123\tdef\n", " \t\n").ToVector(), (Pieces {"abc", "123", "def", ""}));
+
+    std::string value;
+    Pieces expected;
+    for(int i = 0; i < 100; i++)
+    {
+      const std::string piece(static_cast<std::size_t>(i % 37), static_cast<char>('a' + (i % 26)));
+      value += piece + ((i % 2 == 0) ? ";" : ",");
+    }
+
+    std::size_t count = 0u;
+    std::size_t size  = 0u;
+    for(std::string_view piece : Text::SplitAny(value, ",;"))
+    {
+      ASSERT_EQ(piece.find_first_of(",;"), std::string_view::npos);
+      size += piece.size() + 1u;
+      count++;
+    }
+
+    ASSERT_EQ(count, 101u);
+    ASSERT_EQ(size, value.size() + 1u);
+  }
+
+  TEST(Common, Join)
+  {
+    ASSERT_EQ(Text::Join(std::vector<std::string> {}, ", "), "");
+    ASSERT_EQ(Text::Join(std::vector<std::string> {"abc"}, ", "), "abc");
+    ASSERT_EQ(Text::Join(std::vector<std::string> {"abc", "", "123"}, ", "), "abc, , 123");
+    ASSERT_EQ(Text::Join(std::vector<const char*> {"abc", "123"}, ""), "abc123");
+
+    const std::string value = ",abc,,123,";
+    ASSERT_EQ(Text::Join(Text::Split(value, ','), ","), value);
+    ASSERT_EQ(Text::Join(Text::Split(value, ','), "::"), "::abc::::123::");
+  }
+
+  TEST(Common, Parallel)
+  {
+    Text::ThreadPool pool(3u);
+    pool.SetGrainSize(7u);
+
+    std::string value;
+    for(int i = 0; i < 1000; i++)
+    {
+      value.push_back(static_cast<char>(' ' + (i % 95)));
+    }
+
+    std::string tmpValue = value;
+    ASSERT_EQ(Text::ToLowercase(tmpValue, pool), Text::ToLowercaseCopy(value));
+    ASSERT_EQ(Text::ToUppercase(tmpValue, pool), Text::ToUppercaseCopy(value));
+
+    for(std::size_t i = 0u; i < 40u; i++)
+    {
+      tmpValue = value.substr(i, i * 7u);
+      ASSERT_EQ(Text::Reverse(tmpValue, pool), Text::ReverseCopy(value.substr(i, i * 7u)));
+    }
+  }
+
+  TEST(Common, Batch)
+  {
+    Text::ThreadPool pool(3u);
+    pool.SetGrainSize(5u);
+
+    std::vector<std::string> values;
+    for(std::size_t i = 0u; i < 100u; i++)
+    {
+      values.push_back(std::string(i % 3u, ' ') + "Abc " + std::to_string(i) + std::string(i % 4u, '\t'));
+    }
+
+    values.push_back("");
+    values.push_back(" ");
+
+    const Text::StringColumn column(values);
+    ASSERT_EQ(column.GetSize(), values.size());
+    ASSERT_THROW(column.At(values.size()), std::out_of_range);
+
+    const Text::StringColumn lowercase = Text::ToLowercaseCopy(column, pool);
+    const Text::StringColumn uppercase = Text::ToUppercaseCopy(column, pool);
+    const Text::StringColumn trimmed   = Text::Trim(column, pool);
+    const Text::StringColumn reversed  = Text::ReverseCopy(column, pool);
+    for(std::size_t i = 0u; i < values.size(); i++)
+    {
+      ASSERT_EQ(column[i], values[i]);
+      ASSERT_EQ(lowercase[i], Text::ToLowercaseCopy(values[i]));
+      ASSERT_EQ(uppercase[i], Text::ToUppercaseCopy(values[i]));
+      ASSERT_EQ(trimmed[i], Text::Trim(values[i]));
+      ASSERT_EQ(reversed[i], Text::ReverseCopy(values[i]));
+    }
+
+    ASSERT_EQ(Text::Trim(column).GetBytes(), trimmed.GetBytes());
+    ASSERT_THROW(Text::StringColumn(std::string("abc"), std::vector<std::size_t> {0u, 4u}), std::invalid_argument);
+  }
+
   TEST(Common, ToString)
   {
     ASSERT_EQ(Text::ToString('x'), "x");
     ASSERT_EQ(Text::ToString(12345), "12345");
     ASSERT_EQ(Text::ToString(123.45), "123.45");
     ASSERT_EQ(Text::ToString("abc 123"), "abc 123");
+
+    ASSERT_EQ(Text::ToString(true), "1");
+    ASSERT_EQ(Text::ToString(static_cast<unsigned char>('x')), "x");
+    ASSERT_EQ(Text::ToString(-9223372036854775807LL - 1), "-9223372036854775808");
+    ASSERT_EQ(Text::ToString(18446744073709551615ULL), "18446744073709551615");
+    ASSERT_EQ(Text::ToString(123.45f), "123.45");
+    ASSERT_EQ(Text::ToString(0.1 + 0.2), "0.3");
+    ASSERT_EQ(Text::ToString(1234567.0), "1.23457e+06");
+    ASSERT_EQ(Text::ToString(1e-20), "1e-20");
+
+    std::string result = "abc";
+    ASSERT_TRUE(Text::TryToString(-12345, result));
+    ASSERT_EQ(result, "-12345");
+
+    char buffer[8];
+    std::size_t length;
+    ASSERT_TRUE(Text::TryToString(123.45, buffer, sizeof(buffer), length));
+    ASSERT_EQ(std::string(buffer, length), "123.45");
+    ASSERT_TRUE(Text::TryToString(std::string("abc"), buffer, sizeof(buffer), length));
+    ASSERT_EQ(std::string(buffer, length), "abc");
+    ASSERT_FALSE(Text::TryToString(123456789, buffer, sizeof(buffer), length));
+    ASSERT_FALSE(Text::TryToString(std::string("abc 123 456"), buffer, sizeof(buffer), length));
   }
 
   TEST(Common, FromString)
@@ -348,5 +756,19 @@ namespace UnitTest
     ASSERT_EQ(Text::FromString<int>("12345"), 12345);
     ASSERT_EQ(Text::FromString<double>("123.45"), 123.45);
     ASSERT_EQ(Text::FromString<std::string>("abc 123"), "abc");
+
+    ASSERT_EQ(Text::FromString<long long>("-9223372036854775808"), -9223372036854775807LL - 1);
+    ASSERT_EQ(Text::FromString<unsigned long long>("18446744073709551615"), 18446744073709551615ULL);
+    ASSERT_EQ(Text::FromString<float>("123.45"), 123.45f);
+    ASSERT_EQ(Text::FromString<int>(" +123"), 123);
+    ASSERT_EQ(Text::FromString<int>("123abc"), 123);
+    ASSERT_EQ(Text::FromString<double>("1e-20"), 1e-20);
+    ASSERT_EQ(Text::FromString<bool>("1"), true);
+
+    int result;
+    ASSERT_FALSE(Text::TryFromString("abc", result));
+
+    double tmpResult;
+    ASSERT_FALSE(Text::TryFromString("inf", tmpResult));
   }
 } // namespace UnitTest
@@ -0,0 +1,177 @@
+#include "NameIndex.hpp"
+#include "Common.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace Text
+{
+  static constexpr std::size_t __gramSize      = 3u;
+  static constexpr std::size_t __listSizeRatio = 4u;
+
+  static std::uint32_t __getGram(std::string_view value, std::size_t index)
+  {
+    std::uint32_t result = 0u;
+    for(std::size_t i = index; i < index + __gramSize; i++)
+    {
+      const bool isPadding = i < (__gramSize - 1u) || i >= value.size() + (__gramSize - 1u);
+      result               = (result << 8u) | (isPadding ? 0u : static_cast<unsigned char>(value[i - (__gramSize - 1u)]));
+    }
+
+    return result;
+  }
+
+  static std::size_t __getGramCount(std::string_view value) { return value.size() + __gramSize - 1u; }
+
+  static std::size_t __getListSize(const std::vector<std::uint32_t>* value) { return value != nullptr ? value->size() : 0u; }
+
+  std::size_t NameIndex::GetSize() const { return m_Names.size(); }
+
+  bool NameIndex::Contains(std::string_view value) const { return !Find(value, 0u, 1u).empty(); }
+
+  void NameIndex::Insert(std::string_view value)
+  {
+    if(Contains(value))
+    {
+      return;
+    }
+
+    const auto id = static_cast<std::uint32_t>(m_Names.size());
+    m_Names.emplace_back(value);
+    if(m_Lengths.size() <= value.size())
+    {
+      m_Lengths.resize(value.size() + 1u);
+    }
+
+    m_Lengths[value.size()].push_back(id);
+    for(std::size_t i = 0u; i < __getGramCount(value); i++)
+    {
+      m_Grams[__getGram(value, i)].push_back(id);
+    }
+  }
+
+  void NameIndex::Clear()
+  {
+    m_Names.clear();
+    m_Lengths.clear();
+    m_Grams.clear();
+  }
+
+  std::vector<std::string> NameIndex::Find(std::string_view value, std::size_t maximumDistance, std::size_t maximumCount) const
+  {
+    const std::size_t minimumLength = value.size() - std::min(value.size(), maximumDistance);
+    const std::size_t maximumLength = value.size() + maximumDistance;
+
+    std::vector<std::uint32_t> candidates;
+    const std::size_t gramCount   = __getGramCount(value);
+    const std::size_t filterCount = maximumDistance * __gramSize;
+    if(gramCount > filterCount)
+    {
+      std::vector<const std::vector<std::uint32_t>*> lists;
+      lists.reserve(gramCount);
+      for(std::size_t i = 0u; i < gramCount; i++)
+      {
+        const auto grams = m_Grams.find(__getGram(value, i));
+        lists.push_back(grams != m_Grams.cend() ? &grams->second : nullptr);
+      }
+
+      std::sort(lists.begin(), lists.end(), [](const auto* a, const auto* b) { return __getListSize(a) < __getListSize(b); });
+
+      thread_local std::vector<std::uint32_t> counts;
+      counts.resize(std::max(counts.size(), m_Names.size()), 0u);
+
+      std::size_t listCount = 0u;
+      for(; listCount <= filterCount; listCount++)
+      {
+        if(lists[listCount] == nullptr)
+        {
+          continue;
+        }
+
+        for(const std::uint32_t id : *lists[listCount])
+        {
+          const std::size_t length = m_Names[id].size();
+          if(length >= minimumLength && length <= maximumLength && counts[id]++ == 0u)
+          {
+            candidates.push_back(id);
+          }
+        }
+      }
+
+      for(; listCount < gramCount && __getListSize(lists[listCount]) <= candidates.size() * __listSizeRatio; listCount++)
+      {
+        if(lists[listCount] == nullptr)
+        {
+          continue;
+        }
+
+        for(const std::uint32_t id : *lists[listCount])
+        {
+          if(counts[id] != 0u)
+          {
+            counts[id]++;
+          }
+        }
+      }
+
+      const std::size_t skipCount = gramCount - listCount;
+      const auto last             = std::remove_if(candidates.begin(), candidates.end(), [&](std::uint32_t id) {
+        const std::size_t count = std::exchange(counts[id], 0u);
+        return count + filterCount + skipCount < __getGramCount(m_Names[id].size() > value.size() ? m_Names[id] : value);
+      });
+      candidates.erase(last, candidates.end());
+    }
+    else
+    {
+      for(std::size_t length = minimumLength; length <= maximumLength && length < m_Lengths.size(); length++)
+      {
+        candidates.insert(candidates.end(), m_Lengths[length].cbegin(), m_Lengths[length].cend());
+      }
+    }
+
+    std::vector<std::pair<std::size_t, const std::string*>> matches;
+    for(const std::uint32_t id : candidates)
+    {
+      const std::size_t distance = EditDistance(value, m_Names[id]);
+      if(distance <= maximumDistance)
+      {
+        matches.emplace_back(distance, &m_Names[id]);
+      }
+    }
+
+    const std::size_t count = std::min(matches.size(), maximumCount);
+    std::partial_sort(matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(count), matches.end(), [](const auto& a, const auto& b) {
+      return (a.first != b.first) ? (a.first < b.first) : (*a.second < *b.second);
+    });
+
+    std::vector<std::string> results;
+    results.reserve(count);
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      results.push_back(*matches[i].second);
+    }
+
+    return results;
+  }
+
+  std::vector<std::string> NameIndex::Suggest(std::string_view value) const
+  {
+    const std::size_t maximumDistance = std::min(std::max((value.size() + 2u) / 3u, std::size_t(1u)), MaximumSuggestionDistance);
+    for(std::size_t distance = 1u; distance < maximumDistance; distance++)
+    {
+      std::vector<std::string> results = Find(value, distance, DefaultSuggestionCount);
+      if(!results.empty())
+      {
+        return results;
+      }
+    }
+
+    return Find(value, maximumDistance, DefaultSuggestionCount);
+  }
+
+  NameIndex::NameIndex()
+      : m_Names()
+      , m_Lengths()
+      , m_Grams()
+  {}
+} // namespace Text
@@ -0,0 +1,49 @@
+#ifndef __TEXT__NAMEINDEX_HPP__
+#define __TEXT__NAMEINDEX_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Text
+{
+  class NameIndex
+  {
+    public:
+    static constexpr std::size_t DefaultSuggestionCount    = 3u;
+    static constexpr std::size_t MaximumSuggestionDistance = 2u;
+
+    std::size_t GetSize() const;
+    bool Contains(std::string_view value) const;
+
+    void Insert(std::string_view value);
+    void Clear();
+
+    std::vector<std::string> Find(std::string_view value, std::size_t maximumDistance, std::size_t maximumCount) const;
+    std::vector<std::string> Suggest(std::string_view value) const;
+
+    template<class Map>
+    static NameIndex FromKeys(const Map& values)
+    {
+      NameIndex result;
+      for(const auto& value : values)
+      {
+        result.Insert(value.first);
+      }
+
+      return result;
+    }
+
+    NameIndex();
+
+    private:
+    std::vector<std::string> m_Names;
+    std::vector<std::vector<std::uint32_t>> m_Lengths;
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> m_Grams;
+  };
+} // namespace Text
+
+#endif // __TEXT__NAMEINDEX_HPP__
@@ -0,0 +1,68 @@
+#include "NameIndex.hpp"
+#include "Common.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  TEST(NameIndex, Find)
+  {
+    Text::NameIndex instance;
+    ASSERT_TRUE(instance.Find("abc", 3u, 3u).empty());
+
+    for(const char* value : {"print", "printf", "sprint", "point", "list", "last", "lost", "load", "save", "print"})
+    {
+      instance.Insert(value);
+    }
+
+    ASSERT_EQ(instance.GetSize(), 9u);
+    ASSERT_TRUE(instance.Contains("list"));
+    ASSERT_FALSE(instance.Contains("lust"));
+
+    ASSERT_EQ(instance.Find("lust", 1u, 10u), (std::vector<std::string> {"last", "list", "lost"}));
+    ASSERT_EQ(instance.Find("lust", 1u, 2u), (std::vector<std::string> {"last", "list"}));
+    ASSERT_EQ(instance.Find("pirnt", 2u, 10u), (std::vector<std::string> {"point", "print"}));
+    ASSERT_EQ(instance.Find("pirnt", 3u, 10u), (std::vector<std::string> {"point", "print", "list", "printf", "sprint"}));
+    ASSERT_EQ(instance.Find("xyz", 2u, 10u), (std::vector<std::string> {}));
+
+    ASSERT_EQ(instance.Suggest("lsit"), (std::vector<std::string> {"last", "list", "lost"}));
+    ASSERT_EQ(instance.Suggest("sav"), (std::vector<std::string> {"save"}));
+
+    instance.Clear();
+    ASSERT_EQ(instance.GetSize(), 0u);
+  }
+
+  TEST(NameIndex, Exhaustive)
+  {
+    std::vector<std::string> values;
+    for(std::size_t i = 0u; i < 500u; i++)
+    {
+      values.push_back("var" + std::to_string(i * 7919u % 1000u));
+    }
+
+    Text::NameIndex instance;
+    for(const std::string& value : values)
+    {
+      instance.Insert(value);
+    }
+
+    for(std::size_t distance : {0u, 1u, 2u, 3u})
+    {
+      for(const std::string query : {"var12", "vra123", "var9999", "var1x2", "avr", "x"})
+      {
+        const std::vector<std::string> results = instance.Find(query, distance, values.size());
+        for(const std::string& value : values)
+        {
+          const bool isMatch = Text::EditDistance(query, value) <= distance;
+          ASSERT_EQ(std::find(results.cbegin(), results.cend(), value) != results.cend(), isMatch);
+        }
+      }
+    }
+  }
+} // namespace UnitTest
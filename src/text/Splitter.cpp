@@ -0,0 +1,129 @@
+#include "Splitter.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define __TEXT__SPLITTER_SSE2__
+#endif
+
+namespace Text
+{
+  Splitter::Iterator::reference Splitter::Iterator::operator*() const { return m_Current; }
+
+  Splitter::Iterator::pointer Splitter::Iterator::operator->() const { return &m_Current; }
+
+  Splitter::Iterator& Splitter::Iterator::operator++()
+  {
+    const std::size_t end = m_Position + m_Current.size();
+    if(end >= m_pOwner->m_Value.size() && m_DelimiterLength == 0u)
+    {
+      m_Position = Splitter::NoPos;
+      m_Current  = std::string_view();
+    }
+    else
+    {
+      *this = Iterator(m_pOwner, end + m_DelimiterLength);
+    }
+
+    return *this;
+  }
+
+  Splitter::Iterator Splitter::Iterator::operator++(int)
+  {
+    Iterator result = *this;
+    ++(*this);
+    return result;
+  }
+
+  bool Splitter::Iterator::operator==(const Iterator& other) const { return m_Position == other.m_Position; }
+
+  bool Splitter::Iterator::operator!=(const Iterator& other) const { return !(*this == other); }
+
+  Splitter::Iterator::Iterator()
+      : m_pOwner(nullptr)
+      , m_Position(Splitter::NoPos)
+      , m_DelimiterLength(0u)
+      , m_Current()
+  {}
+
+  Splitter::Iterator::Iterator(const Splitter* owner, std::size_t position)
+      : m_pOwner(owner)
+      , m_Position(position)
+      , m_DelimiterLength(0u)
+      , m_Current()
+  {
+    const std::size_t end = owner->Find(position, m_DelimiterLength);
+    m_Current             = owner->m_Value.substr(position, (end != Splitter::NoPos) ? end - position : Splitter::NoPos);
+  }
+
+  Splitter::Iterator Splitter::begin() const { return Iterator(this, 0u); }
+
+  Splitter::Iterator Splitter::end() const { return Iterator(); }
+
+  std::vector<std::string_view> Splitter::ToVector() const { return std::vector<std::string_view>(begin(), end()); }
+
+  std::size_t Splitter::Find(std::size_t position, std::size_t& length) const
+  {
+    const char* begin = m_Value.data() + position;
+    const char* end   = m_Value.data() + m_Value.size();
+    switch(m_Mode)
+    {
+      case Mode::Character:
+      {
+        const void* result = (begin != end) ? std::memchr(begin, m_Delimiter.front(), static_cast<std::size_t>(end - begin)) : nullptr;
+        length             = (result != nullptr) ? 1u : 0u;
+        return (result != nullptr) ? static_cast<std::size_t>(static_cast<const char*>(result) - m_Value.data()) : NoPos;
+      }
+
+      case Mode::CharacterSet:
+      {
+#ifdef __TEXT__SPLITTER_SSE2__
+        for(; end - begin >= 16; begin += 16)
+        {
+          const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+          __m128i matches     = _mm_setzero_si128();
+          for(char delimiter : m_Delimiter)
+          {
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(delimiter)));
+          }
+
+          if(_mm_movemask_epi8(matches) != 0)
+          {
+            break;
+          }
+        }
+#endif
+
+        const std::size_t result = m_Value.find_first_of(m_Delimiter, static_cast<std::size_t>(begin - m_Value.data()));
+        length                   = (result != NoPos) ? 1u : 0u;
+        return result;
+      }
+
+      default:
+      {
+        const std::size_t result = m_Value.find(m_Delimiter, position);
+        length                   = (result != NoPos) ? m_Delimiter.size() : 0u;
+        return result;
+      }
+    }
+  }
+
+  Splitter::Splitter(std::string_view value, char delimiter)
+      : m_Value(value)
+      , m_Delimiter(1u, delimiter)
+      , m_Mode(Mode::Character)
+  {}
+
+  Splitter::Splitter(std::string_view value, std::string_view delimiter, Mode mode)
+      : m_Value(value)
+      , m_Delimiter(delimiter)
+      , m_Mode(mode)
+  {
+    if(m_Delimiter.empty() || (mode == Mode::Character && m_Delimiter.size() != 1u))
+    {
+      throw std::invalid_argument("Invalid delimiter: \"" + m_Delimiter + "\"");
+    }
+  }
+} // namespace Text
@@ -0,0 +1,69 @@
+#ifndef __TEXT__SPLITTER_HPP__
+#define __TEXT__SPLITTER_HPP__
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Text
+{
+  class Splitter
+  {
+    public:
+    enum class Mode
+    {
+      Character,
+      CharacterSet,
+      String
+    };
+
+    class Iterator
+    {
+      public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type        = std::string_view;
+      using difference_type   = std::ptrdiff_t;
+      using pointer           = const std::string_view*;
+      using reference         = const std::string_view&;
+
+      reference operator*() const;
+      pointer operator->() const;
+      Iterator& operator++();
+      Iterator operator++(int);
+      bool operator==(const Iterator& other) const;
+      bool operator!=(const Iterator& other) const;
+
+      Iterator();
+
+      private:
+      friend class Splitter;
+
+      const Splitter* m_pOwner;
+      std::size_t m_Position;
+      std::size_t m_DelimiterLength;
+      std::string_view m_Current;
+
+      Iterator(const Splitter* owner, std::size_t position);
+    };
+
+    static constexpr std::size_t NoPos = std::string_view::npos;
+
+    Iterator begin() const;
+    Iterator end() const;
+    std::vector<std::string_view> ToVector() const;
+
+    Splitter(std::string_view value, char delimiter);
+    Splitter(std::string_view value, std::string_view delimiter, Mode mode);
+
+    private:
+    std::string_view m_Value;
+    std::string m_Delimiter;
+    Mode m_Mode;
+
+    std::size_t Find(std::size_t position, std::size_t& length) const;
+  };
+} // namespace Text
+
+#endif // __TEXT__SPLITTER_HPP__
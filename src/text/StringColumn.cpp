@@ -0,0 +1,79 @@
+#include "StringColumn.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Text
+{
+  std::size_t StringColumn::GetSize() const { return m_Offsets.size() - 1u; }
+
+  bool StringColumn::IsEmpty() const { return m_Offsets.size() == 1u; }
+
+  const std::string& StringColumn::GetBytes() const { return m_Bytes; }
+
+  const std::vector<std::size_t>& StringColumn::GetOffsets() const { return m_Offsets; }
+
+  std::string_view StringColumn::operator[](std::size_t index) const
+  {
+    return std::string_view(m_Bytes.data() + m_Offsets[index], m_Offsets[index + 1u] - m_Offsets[index]);
+  }
+
+  std::string_view StringColumn::At(std::size_t index) const
+  {
+    if(index >= GetSize())
+    {
+      throw std::out_of_range("Index out of range: " + std::to_string(index));
+    }
+
+    return (*this)[index];
+  }
+
+  void StringColumn::Reserve(std::size_t count, std::size_t size)
+  {
+    m_Offsets.reserve(count + 1u);
+    m_Bytes.reserve(size);
+  }
+
+  void StringColumn::Push(std::string_view value)
+  {
+    m_Bytes.append(value);
+    m_Offsets.push_back(m_Bytes.size());
+  }
+
+  void StringColumn::Clear()
+  {
+    m_Bytes.clear();
+    m_Offsets.assign(1u, 0u);
+  }
+
+  StringColumn::StringColumn(std::string&& bytes, std::vector<std::size_t>&& offsets)
+      : m_Bytes(std::move(bytes))
+      , m_Offsets(std::move(offsets))
+  {
+    if(m_Offsets.empty() || m_Offsets.front() != 0u || m_Offsets.back() != m_Bytes.size() || !std::is_sorted(m_Offsets.cbegin(), m_Offsets.cend()))
+    {
+      throw std::invalid_argument("Invalid column offsets");
+    }
+  }
+
+  StringColumn::StringColumn(const std::vector<std::string>& values)
+      : StringColumn()
+  {
+    std::size_t size = 0u;
+    for(const std::string& value : values)
+    {
+      size += value.size();
+    }
+
+    Reserve(values.size(), size);
+    for(const std::string& value : values)
+    {
+      Push(value);
+    }
+  }
+
+  StringColumn::StringColumn()
+      : m_Bytes()
+      , m_Offsets(1u, 0u)
+  {}
+} // namespace Text
@@ -0,0 +1,36 @@
+#ifndef __TEXT__STRINGCOLUMN_HPP__
+#define __TEXT__STRINGCOLUMN_HPP__
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Text
+{
+  class StringColumn
+  {
+    public:
+    std::size_t GetSize() const;
+    bool IsEmpty() const;
+    const std::string& GetBytes() const;
+    const std::vector<std::size_t>& GetOffsets() const;
+
+    std::string_view operator[](std::size_t index) const;
+    std::string_view At(std::size_t index) const;
+
+    void Reserve(std::size_t count, std::size_t size);
+    void Push(std::string_view value);
+    void Clear();
+
+    StringColumn(std::string&& bytes, std::vector<std::size_t>&& offsets);
+    explicit StringColumn(const std::vector<std::string>& values);
+    StringColumn();
+
+    private:
+    std::string m_Bytes;
+    std::vector<std::size_t> m_Offsets;
+  };
+} // namespace Text
+
+#endif // __TEXT__STRINGCOLUMN_HPP__
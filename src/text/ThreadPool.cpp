@@ -0,0 +1,174 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+
+namespace Text
+{
+  ThreadPool& ThreadPool::GetDefault()
+  {
+    static ThreadPool instance;
+    return instance;
+  }
+
+  std::size_t ThreadPool::GetThreadCount() const { return m_Threads.size(); }
+
+  std::size_t ThreadPool::GetGrainSize() const { return m_GrainSize.load(); }
+
+  void ThreadPool::SetGrainSize(std::size_t value)
+  {
+    if(value == 0u)
+    {
+      throw std::invalid_argument("Grain size must be positive");
+    }
+
+    m_GrainSize = value;
+  }
+
+  void ThreadPool::ParallelFor(std::size_t size, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& callback)
+  {
+    grainSize                   = std::max(grainSize, std::size_t(1u));
+    const std::size_t taskCount = (size / grainSize) + ((size % grainSize) != 0u ? 1u : 0u);
+    if(taskCount <= 1u || m_Threads.empty())
+    {
+      if(size > 0u)
+      {
+        callback(0u, size);
+      }
+
+      return;
+    }
+
+    struct State
+    {
+      std::mutex Mutex;
+      std::condition_variable Condition;
+      std::size_t Running = 0u;
+      bool IsClosed       = false;
+    };
+
+    std::atomic<std::size_t> next(0u);
+    std::exception_ptr exception;
+    std::mutex mutex;
+    const std::shared_ptr<State> state = std::make_shared<State>();
+    const std::size_t helperCount      = std::min(taskCount - 1u, m_Threads.size());
+
+    auto worker = [&]() {
+      std::size_t index;
+      while((index = next.fetch_add(1u)) < taskCount)
+      {
+        try
+        {
+          const std::size_t begin = index * grainSize;
+          callback(begin, std::min(begin + grainSize, size));
+        }
+        catch(...)
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          if(!exception)
+          {
+            exception = std::current_exception();
+          }
+
+          next = taskCount;
+        }
+      }
+    };
+
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      for(std::size_t i = 0u; i < helperCount; i++)
+      {
+        m_Tasks.push([state, &worker]() {
+          {
+            std::lock_guard<std::mutex> lock(state->Mutex);
+            if(state->IsClosed)
+            {
+              return;
+            }
+
+            state->Running++;
+          }
+
+          worker();
+          std::lock_guard<std::mutex> lock(state->Mutex);
+          state->Running--;
+          state->Condition.notify_one();
+        });
+      }
+    }
+
+    m_Condition.notify_all();
+    worker();
+
+    std::unique_lock<std::mutex> lock(state->Mutex);
+    state->IsClosed = true;
+    state->Condition.wait(lock, [&state]() { return state->Running == 0u; });
+    if(exception)
+    {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  void ThreadPool::ParallelFor(std::size_t size, const std::function<void(std::size_t, std::size_t)>& callback)
+  {
+    ParallelFor(size, m_GrainSize.load(), callback);
+  }
+
+  void ThreadPool::Run()
+  {
+    while(true)
+    {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_Condition.wait(lock, [this]() { return m_IsStopping || !m_Tasks.empty(); });
+        if(m_Tasks.empty())
+        {
+          return;
+        }
+
+        task = std::move(m_Tasks.front());
+        m_Tasks.pop();
+      }
+
+      task();
+    }
+  }
+
+  ThreadPool::ThreadPool(std::size_t threadCount)
+      : m_Threads()
+      , m_Tasks()
+      , m_Mutex()
+      , m_Condition()
+      , m_IsStopping(false)
+      , m_GrainSize(DefaultGrainSize)
+  {
+    m_Threads.reserve(threadCount);
+    for(std::size_t i = 0u; i < threadCount; i++)
+    {
+      m_Threads.emplace_back(&ThreadPool::Run, this);
+    }
+  }
+
+  ThreadPool::ThreadPool()
+      : ThreadPool(std::max(std::thread::hardware_concurrency(), 1u) - 1u)
+  {}
+
+  ThreadPool::~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_IsStopping = true;
+    }
+
+    m_Condition.notify_all();
+    for(std::thread& thread : m_Threads)
+    {
+      thread.join();
+    }
+  }
+} // namespace Text
@@ -0,0 +1,48 @@
+#ifndef __TEXT__THREADPOOL_HPP__
+#define __TEXT__THREADPOOL_HPP__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace Text
+{
+  class ThreadPool
+  {
+    public:
+    static constexpr std::size_t DefaultGrainSize = 1u << 20u;
+
+    static ThreadPool& GetDefault();
+
+    std::size_t GetThreadCount() const;
+    std::size_t GetGrainSize() const;
+    void SetGrainSize(std::size_t value);
+
+    void ParallelFor(std::size_t size, std::size_t grainSize, const std::function<void(std::size_t, std::size_t)>& callback);
+    void ParallelFor(std::size_t size, const std::function<void(std::size_t, std::size_t)>& callback);
+
+    ThreadPool(std::size_t threadCount);
+    ThreadPool();
+    ~ThreadPool();
+
+    private:
+    std::vector<std::thread> m_Threads;
+    std::queue<std::function<void()>> m_Tasks;
+    std::mutex m_Mutex;
+    std::condition_variable m_Condition;
+    bool m_IsStopping;
+    std::atomic<std::size_t> m_GrainSize;
+
+    void Run();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+  };
+} // namespace Text
+
+#endif // __TEXT__THREADPOOL_HPP__
@@ -0,0 +1,83 @@
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+
+namespace UnitTest
+{
+  TEST(ThreadPool, ParallelFor)
+  {
+    Text::ThreadPool instance(3u);
+    ASSERT_EQ(instance.GetThreadCount(), 3u);
+
+    for(std::size_t size : {0u, 1u, 7u, 1000u})
+    {
+      std::vector<int> values(size, 0);
+      std::atomic<std::size_t> calls(0u);
+      instance.ParallelFor(size, 10u, [&values, &calls](std::size_t begin, std::size_t end) {
+        ASSERT_LE(end - begin, 10u);
+        for(std::size_t i = begin; i < end; i++)
+        {
+          values[i]++;
+        }
+
+        calls++;
+      });
+
+      ASSERT_EQ(std::accumulate(values.cbegin(), values.cend(), 0), static_cast<int>(size));
+      ASSERT_EQ(calls, (size + 9u) / 10u);
+    }
+  }
+
+  TEST(ThreadPool, GrainSize)
+  {
+    Text::ThreadPool instance(0u);
+    ASSERT_EQ(instance.GetGrainSize(), Text::ThreadPool::DefaultGrainSize);
+    ASSERT_THROW(instance.SetGrainSize(0u), std::invalid_argument);
+
+    instance.SetGrainSize(4u);
+    std::size_t calls = 0u;
+    instance.ParallelFor(10u, [&calls](std::size_t begin, std::size_t end) {
+      ASSERT_EQ(begin, 0u);
+      ASSERT_EQ(end, 10u);
+      calls++;
+    });
+
+    ASSERT_EQ(calls, 1u);
+  }
+
+  TEST(ThreadPool, Exception)
+  {
+    Text::ThreadPool instance(2u);
+    ASSERT_THROW(instance.ParallelFor(100u,
+                                      1u,
+                                      [](std::size_t begin, std::size_t) {
+                                        if(begin == 50u)
+                                        {
+                                          throw std::runtime_error("Error");
+                                        }
+                                      }),
+                 std::runtime_error);
+
+    std::atomic<std::size_t> calls(0u);
+    instance.ParallelFor(100u, 1u, [&calls](std::size_t, std::size_t) { calls++; });
+    ASSERT_EQ(calls, 100u);
+  }
+
+  TEST(ThreadPool, Nested)
+  {
+    Text::ThreadPool instance(2u);
+    std::atomic<std::size_t> calls(0u);
+    instance.ParallelFor(8u, 1u, [&instance, &calls](std::size_t, std::size_t) {
+      instance.ParallelFor(64u, 1u, [&calls](std::size_t, std::size_t) { calls++; });
+    });
+
+    ASSERT_EQ(calls, 8u * 64u);
+  }
+} // namespace UnitTest
@@ -4,40 +4,121 @@ namespace Text::Exception
 {
   const std::size_t& SyntaxError::GetIndex() const { return m_Index; }
 
+  const Parsing::Location& SyntaxError::GetLocation() const { return m_Location; }
+
+  const std::vector<std::string>& SyntaxError::GetSuggestions() const
+  {
+    static const std::vector<std::string> empty;
+    return m_pSuggestions != nullptr ? *m_pSuggestions : empty;
+  }
+
   SyntaxError::SyntaxError(const std::string& message)
       : std::runtime_error(message)
       , m_Index(-1)
+      , m_Location()
+      , m_pSuggestions()
   {}
 
   SyntaxError::SyntaxError(const char* message)
       : std::runtime_error(message)
       , m_Index(-1)
+      , m_Location()
+      , m_pSuggestions()
   {}
 
   SyntaxError::SyntaxError(std::size_t index)
       : std::runtime_error(CreateMessage(k_DefaultMessage, index))
       , m_Index(index)
+      , m_Location()
+      , m_pSuggestions()
   {}
 
   SyntaxError::SyntaxError(const std::string& message, std::size_t index)
       : std::runtime_error(CreateMessage(message, index))
       , m_Index(index)
+      , m_Location()
+      , m_pSuggestions()
   {}
 
   SyntaxError::SyntaxError(const char* message, std::size_t index)
       : std::runtime_error(CreateMessage(message, index))
       , m_Index(index)
+      , m_Location()
+      , m_pSuggestions()
+  {}
+
+  SyntaxError::SyntaxError(const std::string& message, std::size_t index, const Parsing::Location& location)
+      : std::runtime_error(CreateMessage(message, index, location))
+      , m_Index(index)
+      , m_Location(location)
+      , m_pSuggestions()
+  {}
+
+  SyntaxError::SyntaxError(const char* message, std::size_t index, const Parsing::Location& location)
+      : std::runtime_error(CreateMessage(message, index, location))
+      , m_Index(index)
+      , m_Location(location)
+      , m_pSuggestions()
+  {}
+
+  SyntaxError::SyntaxError(const std::string& message, std::size_t index, const Parsing::Location& location, const std::vector<std::string>& suggestions)
+      : std::runtime_error(CreateMessage(message, index, location, suggestions))
+      , m_Index(index)
+      , m_Location(location)
+      , m_pSuggestions(!suggestions.empty() ? std::make_shared<const std::vector<std::string>>(suggestions) : nullptr)
+  {}
+
+  SyntaxError::SyntaxError(const std::string& message, std::size_t index, const Parsing::Location& location, std::vector<std::string>&& suggestions)
+      : std::runtime_error(CreateMessage(message, index, location, suggestions))
+      , m_Index(index)
+      , m_Location(location)
+      , m_pSuggestions(!suggestions.empty() ? std::make_shared<const std::vector<std::string>>(std::move(suggestions)) : nullptr)
   {}
 
   SyntaxError::SyntaxError()
       : std::runtime_error(k_DefaultMessage)
       , m_Index(-1)
+      , m_Location()
+      , m_pSuggestions()
   {}
 
   SyntaxError::SyntaxError(const SyntaxError& other) noexcept
       : std::runtime_error(other)
       , m_Index(other.m_Index)
+      , m_Location(other.m_Location)
+      , m_pSuggestions(other.m_pSuggestions)
   {}
 
   std::string SyntaxError::CreateMessage(const std::string& message, std::size_t index) { return message + " (Index: " + std::to_string(index) + ")"; }
+
+  std::string SyntaxError::CreateMessage(const std::string& message, std::size_t index, const Parsing::Location& location)
+  {
+    if(!location.IsValid())
+    {
+      return CreateMessage(message, index);
+    }
+
+    return message + " (Index: " + std::to_string(index) + ", Line: " + std::to_string(location.GetLine()) +
+           ", Column: " + std::to_string(location.GetColumn()) + ")";
+  }
+
+  std::string SyntaxError::CreateMessage(const std::string& message,
+                                         std::size_t index,
+                                         const Parsing::Location& location,
+                                         const std::vector<std::string>& suggestions)
+  {
+    std::string result = CreateMessage(message, index, location);
+    if(!suggestions.empty())
+    {
+      result += " Did you mean: " + suggestions.front();
+      for(std::size_t i = 1u; i < suggestions.size(); i++)
+      {
+        result += ", " + suggestions[i];
+      }
+
+      result += "?";
+    }
+
+    return result;
+  }
 } // namespace Text::Exception
@@ -1,7 +1,12 @@
 #ifndef __TEXT_EXCEPTION_SYNTAXERROR_HPP__
 #define __TEXT_EXCEPTION_SYNTAXERROR_HPP__
 
+#include "text/parsing/Location.hpp"
+
+#include <memory>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace Text::Exception
 {
@@ -9,21 +14,34 @@ namespace Text::Exception
   {
     public:
     const std::size_t& GetIndex() const;
+    const Parsing::Location& GetLocation() const;
+    const std::vector<std::string>& GetSuggestions() const;
 
     SyntaxError(const std::string& message);
     SyntaxError(const char* message);
     SyntaxError(std::size_t index);
     SyntaxError(const std::string& message, std::size_t index);
     SyntaxError(const char* message, std::size_t index);
+    SyntaxError(const std::string& message, std::size_t index, const Parsing::Location& location);
+    SyntaxError(const char* message, std::size_t index, const Parsing::Location& location);
+    SyntaxError(const std::string& message, std::size_t index, const Parsing::Location& location, const std::vector<std::string>& suggestions);
+    SyntaxError(const std::string& message, std::size_t index, const Parsing::Location& location, std::vector<std::string>&& suggestions);
     SyntaxError();
     SyntaxError(const SyntaxError& other) noexcept;
 
     private:
     static std::string CreateMessage(const std::string& message, std::size_t index);
+    static std::string CreateMessage(const std::string& message, std::size_t index, const Parsing::Location& location);
+    static std::string CreateMessage(const std::string& message,
+                                     std::size_t index,
+                                     const Parsing::Location& location,
+                                     const std::vector<std::string>& suggestions);
 
     constexpr static const char* k_DefaultMessage = "Syntax error";
 
     const std::size_t m_Index;
+    const Parsing::Location m_Location;
+    const std::shared_ptr<const std::vector<std::string>> m_pSuggestions;
   };
 } // namespace Text::Exception
 
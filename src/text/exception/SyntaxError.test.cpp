@@ -8,4 +8,41 @@ using namespace Text::Exception;
 namespace UnitTest
 {
   TEST(SyntaxError, Construct) {}
+
+  TEST(SyntaxError, Location)
+  {
+    {
+      SyntaxError error("Unknown identifier", 7u);
+      ASSERT_EQ(error.GetIndex(), 7u);
+      ASSERT_FALSE(error.GetLocation().IsValid());
+      ASSERT_STREQ(error.what(), "Unknown identifier (Index: 7)");
+    }
+
+    {
+      SyntaxError error("Unknown identifier", 7u, Text::Parsing::Location(2u, 3u));
+      ASSERT_EQ(error.GetIndex(), 7u);
+      ASSERT_TRUE(error.GetLocation().IsValid());
+      ASSERT_EQ(error.GetLocation().GetLine(), 2u);
+      ASSERT_EQ(error.GetLocation().GetColumn(), 3u);
+      ASSERT_STREQ(error.what(), "Unknown identifier (Index: 7, Line: 2, Column: 3)");
+    }
+  }
+
+  TEST(SyntaxError, Suggestions)
+  {
+    {
+      SyntaxError error("Unknown identifier", 7u, Text::Parsing::Location(2u, 3u), {});
+      ASSERT_TRUE(error.GetSuggestions().empty());
+      ASSERT_STREQ(error.what(), "Unknown identifier (Index: 7, Line: 2, Column: 3)");
+    }
+
+    {
+      SyntaxError error("Unknown identifier", 7u, Text::Parsing::Location(2u, 3u), {"list", "last"});
+      ASSERT_EQ(error.GetSuggestions(), (std::vector<std::string> {"list", "last"}));
+      ASSERT_STREQ(error.what(), "Unknown identifier (Index: 7, Line: 2, Column: 3) Did you mean: list, last?");
+
+      const SyntaxError copy(error);
+      ASSERT_EQ(&copy.GetSuggestions(), &error.GetSuggestions());
+    }
+  }
 } // namespace UnitTest
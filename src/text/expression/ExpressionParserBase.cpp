@@ -6,7 +6,7 @@ namespace Text::Expression
 {
   std::queue<IToken*> ExpressionParserBase::Parse(const std::string& expression)
   {
-    auto tokens  = ExpressionTokenizer::Execute(expression, m_pUnaryOperators, m_pBinaryOperators, m_pVariables, m_pFunctions);
+    auto tokens  = ExpressionTokenizer::Execute(expression, m_pUnaryOperators, m_BinaryOperators, m_Variables, m_Functions);
     auto postfix = ExpressionPostfixParser::Execute(tokens);
 
     return postfix;
@@ -14,29 +14,38 @@ namespace Text::Expression
 
   IValueToken* ExpressionParserBase::Evaluate(std::queue<IToken*>& postfix) { return ExpressionEvaluator::Execute(postfix); }
 
-  void ExpressionParserBase::SetUnaryOperators(const std::unordered_map<char, IUnaryOperatorToken*>* value) { m_pUnaryOperators = value; }
-  void ExpressionParserBase::SetBinaryOperators(const std::unordered_map<std::string, IBinaryOperatorToken*>* value) { m_pBinaryOperators = value; }
-  void ExpressionParserBase::SetVariables(const std::unordered_map<std::string, IVariableToken*>* value) { m_pVariables = value; }
-  void ExpressionParserBase::SetFunctions(const std::unordered_map<std::string, IFunctionToken*>* value) { m_pFunctions = value; }
+  void ExpressionParserBase::SetUnaryOperators(const ExpressionTokenizer::UnaryOperatorCollection* value) { m_pUnaryOperators = value; }
+  void ExpressionParserBase::SetBinaryOperators(StringMapView<IBinaryOperatorToken*> value) { m_BinaryOperators = value; }
+  void ExpressionParserBase::SetVariables(StringMapView<IVariableToken*> value) { m_Variables = value; }
+  void ExpressionParserBase::SetFunctions(StringMapView<IFunctionToken*> value) { m_Functions = value; }
 
   ExpressionParserBase::ExpressionParserBase()
       : ExpressionTokenizer()
       , ExpressionPostfixParser()
       , ExpressionEvaluator()
-      , m_pVariables(nullptr)
+      , m_pUnaryOperators(nullptr)
+      , m_BinaryOperators()
+      , m_Variables()
+      , m_Functions()
   {}
 
   ExpressionParserBase::ExpressionParserBase(const ExpressionParserBase& other)
       : ExpressionTokenizer(other)
       , ExpressionPostfixParser(other)
       , ExpressionEvaluator(other)
-      , m_pVariables(other.m_pVariables)
+      , m_pUnaryOperators(other.m_pUnaryOperators)
+      , m_BinaryOperators(other.m_BinaryOperators)
+      , m_Variables(other.m_Variables)
+      , m_Functions(other.m_Functions)
   {}
 
   ExpressionParserBase::ExpressionParserBase(ExpressionParserBase&& other)
       : ExpressionTokenizer(std::move(other))
       , ExpressionPostfixParser(std::move(other))
       , ExpressionEvaluator(std::move(other))
-      , m_pVariables(std::move(other.m_pVariables))
+      , m_pUnaryOperators(std::move(other.m_pUnaryOperators))
+      , m_BinaryOperators(std::move(other.m_BinaryOperators))
+      , m_Variables(std::move(other.m_Variables))
+      , m_Functions(std::move(other.m_Functions))
   {}
 } // namespace Text::Expression
@@ -16,10 +16,10 @@ namespace Text::Expression
     std::queue<IToken*> Parse(const std::string& expression);
     IValueToken* Evaluate(std::queue<IToken*>& postfix);
 
-    void SetUnaryOperators(const std::unordered_map<char, IUnaryOperatorToken*>* value);
-    void SetBinaryOperators(const std::unordered_map<std::string, IBinaryOperatorToken*>* value);
-    void SetVariables(const std::unordered_map<std::string, IVariableToken*>* value);
-    void SetFunctions(const std::unordered_map<std::string, IFunctionToken*>* value);
+    void SetUnaryOperators(const ExpressionTokenizer::UnaryOperatorCollection* value);
+    void SetBinaryOperators(StringMapView<IBinaryOperatorToken*> value);
+    void SetVariables(StringMapView<IVariableToken*> value);
+    void SetFunctions(StringMapView<IFunctionToken*> value);
 
     virtual ~ExpressionParserBase() override = default;
     ExpressionParserBase();
@@ -31,10 +31,10 @@ namespace Text::Expression
     using ExpressionPostfixParser::Execute;
     using ExpressionEvaluator::Execute;
 
-    const std::unordered_map<char, IUnaryOperatorToken*>* m_pUnaryOperators;
-    const std::unordered_map<std::string, IBinaryOperatorToken*>* m_pBinaryOperators;
-    const std::unordered_map<std::string, IVariableToken*>* m_pVariables;
-    const std::unordered_map<std::string, IFunctionToken*>* m_pFunctions;
+    const ExpressionTokenizer::UnaryOperatorCollection* m_pUnaryOperators;
+    StringMapView<IBinaryOperatorToken*> m_BinaryOperators;
+    StringMapView<IVariableToken*> m_Variables;
+    StringMapView<IFunctionToken*> m_Functions;
   };
 } // namespace Text::Expression
 
@@ -12,15 +12,42 @@
 namespace Text::Expression
 {
   std::queue<IToken*> ExpressionTokenizer::Execute(const std::string& expression,
-                                                   const std::unordered_map<char, IUnaryOperatorToken*>* unaryOperators,
-                                                   const std::unordered_map<std::string, IBinaryOperatorToken*>* binaryOperators,
-                                                   const std::unordered_map<std::string, IVariableToken*>* variables,
-                                                   const std::unordered_map<std::string, IFunctionToken*>* functions)
+                                                   const ExpressionTokenizer::UnaryOperatorCollection* unaryOperators,
+                                                   StringMapView<IBinaryOperatorToken*> binaryOperators,
+                                                   StringMapView<IVariableToken*> variables,
+                                                   StringMapView<IFunctionToken*> functions)
+  {
+    this->SetText(expression);
+    return Tokenize(unaryOperators, binaryOperators, variables, functions, false);
+  }
+
+  bool ExpressionTokenizer::ExecuteNext(std::queue<IToken*>& result,
+                                        const ExpressionTokenizer::UnaryOperatorCollection* unaryOperators,
+                                        StringMapView<IBinaryOperatorToken*> binaryOperators,
+                                        StringMapView<IVariableToken*> variables,
+                                        StringMapView<IFunctionToken*> functions)
+  {
+    Next(Parser::IsWhitespace);
+    Discard();
+    if(!GetState() || (IsOpen() && Find('\n') == Parsing::ParserBase::NoPos))
+    {
+      return false;
+    }
+
+    result = Tokenize(unaryOperators, binaryOperators, variables, functions, true);
+    Next([](char c) { return c != '\n'; });
+    return true;
+  }
+
+  std::queue<IToken*> ExpressionTokenizer::Tokenize(const ExpressionTokenizer::UnaryOperatorCollection* unaryOperators,
+                                                    StringMapView<IBinaryOperatorToken*> binaryOperators,
+                                                    StringMapView<IVariableToken*> variables,
+                                                    StringMapView<IFunctionToken*> functions,
+                                                    bool isLineTerminated)
   {
     using MiscType = GenericToken<char>;
 
     m_TokenCache.clear();
-    this->SetText(expression);
 
     std::unordered_set<char> unOps;
     std::unordered_set<char> binOps;
@@ -34,19 +61,18 @@ namespace Text::Expression
 
     if(hasBinOps)
     {
-      for(const auto& i : *binaryOperators)
-      {
-        std::transform(i.first.begin(), i.first.end(), std::inserter(binOps, binOps.end()), [](const auto& ch) { return ch; });
-      }
+      binaryOperators.ForEach([&binOps](const std::string& identifier, IBinaryOperatorToken*) {
+        std::transform(identifier.begin(), identifier.end(), std::inserter(binOps, binOps.end()), [](const auto& ch) { return ch; });
+      });
     }
 
     IToken* current = nullptr;
     std::queue<IToken*> result;
     while(GetState())
     {
-      Next(Parser::IsWhitespace);
+      Next(isLineTerminated ? Parser::IsBlank : Parser::IsWhitespace);
 
-      if(!GetState() || m_TerminatorCharacters.find(GetCurrent()) != std::string::npos)
+      if(!GetState() || GetCurrent() == '\n' || m_TerminatorCharacters.find(GetCurrent()) != std::string::npos)
       {
         break;
       }
@@ -55,7 +81,9 @@ namespace Text::Expression
         std::string stringValue = ParseNumber();
         if(m_OnParseNumberCallback == nullptr)
         {
-          throw Exception::SyntaxError("Unhandled numeric token: " + stringValue, GetIndex() - stringValue.length());
+          throw Exception::SyntaxError("Unhandled numeric token: " + stringValue,
+                                       GetIndex() - stringValue.length(),
+                                       GetLocation(GetIndex() - stringValue.length()));
         }
 
         auto value = m_OnParseNumberCallback(stringValue);
@@ -68,11 +96,15 @@ namespace Text::Expression
         std::string stringValue = ParseString();
         if(GetCurrent() != quote)
         {
-          throw Exception::SyntaxError("Unterminated string: " + stringValue, GetIndex() - stringValue.length());
+          throw Exception::SyntaxError("Unterminated string: " + stringValue,
+                                       GetIndex() - stringValue.length(),
+                                       GetLocation(GetIndex() - stringValue.length()));
         }
         else if(m_OnParseStringCallback == nullptr)
         {
-          throw Exception::SyntaxError("Unhandled string token: " + stringValue, GetIndex() - stringValue.length());
+          throw Exception::SyntaxError("Unhandled string token: " + stringValue,
+                                       GetIndex() - stringValue.length(),
+                                       GetLocation(GetIndex() - stringValue.length()));
         }
 
         auto value = m_OnParseStringCallback(stringValue);
@@ -89,7 +121,7 @@ namespace Text::Expression
           const auto iter = unaryOperators->find(GetCurrent());
           if(iter == unaryOperators->cend())
           {
-            throw Exception::SyntaxError("Unknown unary operator: " + GetCurrent(), GetIndex());
+            throw Exception::SyntaxError("Unknown unary operator: " + GetCurrent(), GetIndex(), GetLocation());
           }
 
           current = iter->second;
@@ -100,50 +132,57 @@ namespace Text::Expression
           std::string identifier = Get(1u);
           identifier += Get([unOps, binOps](char c) { return binOps.find(c) != binOps.end() && unOps.find(c) == unOps.end(); });
 
-          const auto iter = binaryOperators->find(identifier);
-          if(iter == binaryOperators->cend())
+          IBinaryOperatorToken* const* pOperator = binaryOperators.Find(identifier);
+          if(pOperator == nullptr)
           {
-            throw Exception::SyntaxError("Unknown binary operator: " + identifier, GetIndex() - identifier.length());
+            throw Exception::SyntaxError("Unknown binary operator: " + identifier,
+                                         GetIndex() - identifier.length(),
+                                         GetLocation(GetIndex() - identifier.length()));
           }
 
-          current = iter->second;
+          current = *pOperator;
         }
         else
         {
-          throw Exception::SyntaxError("Unknown operator: " + GetCurrent(), GetIndex());
+          throw Exception::SyntaxError("Unknown operator: " + GetCurrent(), GetIndex(), GetLocation());
         }
       }
       else if(IsIdentifier(GetCurrent()))
       {
         std::string identifier = ParseIdentifier();
 
-        typename std::unordered_map<std::string, IFunctionToken*>::const_iterator functionIter;
-        typename std::unordered_map<std::string, IVariableToken*>::const_iterator variableIter;
-        if(functions != nullptr && (functionIter = functions->find(identifier)) != functions->cend())
+        IFunctionToken* const* pFunction;
+        IVariableToken* const* pVariable;
+        if((pFunction = functions.Find(identifier)) != nullptr)
         {
-          current = functionIter->second;
+          current = *pFunction;
 
           Next(Parser::IsWhitespace);
           if(GetCurrent() != '(')
           {
-            throw Exception::SyntaxError("Expected function opening parenthesis: " + functionIter->second->GetIdentifier(), GetIndex() - identifier.length());
+            throw Exception::SyntaxError("Expected function opening parenthesis: " + (*pFunction)->GetIdentifier(),
+                                         GetIndex() - identifier.length(),
+                                         GetLocation(GetIndex() - identifier.length()));
           }
         }
-        else if(variables != nullptr && (variableIter = variables->find(identifier)) != variables->cend())
+        else if((pVariable = variables.Find(identifier)) != nullptr)
         {
-          current = variableIter->second;
+          current = *pVariable;
         }
         else
         {
           if(m_OnParseUnknownIdentifier == nullptr)
           {
-            throw Exception::SyntaxError("Unkown identifier: " + identifier, GetIndex() - identifier.length());
+            throw Exception::SyntaxError("Unkown identifier: " + identifier,
+                                         GetIndex() - identifier.length(),
+                                         GetLocation(GetIndex() - identifier.length()),
+                                         (m_pNameIndex != nullptr) ? m_pNameIndex->Suggest(identifier) : std::vector<std::string>());
           }
 
           auto value = m_OnParseUnknownIdentifier(identifier);
           if(value == nullptr)
           {
-            throw Exception::SyntaxError("Invalid identifier: " + identifier, GetIndex() - identifier.length());
+            throw Exception::SyntaxError("Invalid identifier: " + identifier, GetIndex() - identifier.length(), GetLocation(GetIndex() - identifier.length()));
           }
 
           current = value;
@@ -157,7 +196,7 @@ namespace Text::Expression
       }
       else
       {
-        throw Exception::SyntaxError("Unknown token: " + GetCurrent(), GetIndex());
+        throw Exception::SyntaxError("Unknown token: " + GetCurrent(), GetIndex(), GetLocation());
       }
 
       if(m_pJuxtapositionOperator != nullptr && !result.empty())
@@ -186,6 +225,8 @@ namespace Text::Expression
   void ExpressionTokenizer::SetOnParseStringCallback(const std::function<IValueToken*(const std::string&)>& value) { m_OnParseStringCallback = value; }
   void ExpressionTokenizer::SetOnUnknownIdentifierCallback(const std::function<IValueToken*(const std::string&)>& value) { m_OnParseUnknownIdentifier = value; }
   void ExpressionTokenizer::SetJuxtapositionOperator(IBinaryOperatorToken* value) { m_pJuxtapositionOperator = value; }
+  const NameIndex* ExpressionTokenizer::GetNameIndex() const { return m_pNameIndex; }
+  void ExpressionTokenizer::SetNameIndex(const NameIndex* value) { m_pNameIndex = value; }
 
   const std::string& ExpressionTokenizer::GetTerminatorCharacters() const { return m_TerminatorCharacters; }
   void ExpressionTokenizer::SetTerminatorCharacters(const std::string& value) { m_TerminatorCharacters = value; }
@@ -196,6 +237,7 @@ namespace Text::Expression
       , m_OnParseStringCallback()
       , m_OnParseUnknownIdentifier()
       , m_pJuxtapositionOperator()
+      , m_pNameIndex(nullptr)
       , m_TerminatorCharacters(ExpressionTokenizer::DefaultTerminatorCharacters)
       , m_TokenCache()
   {}
@@ -206,6 +248,7 @@ namespace Text::Expression
       , m_OnParseStringCallback(other.m_OnParseStringCallback)
       , m_OnParseUnknownIdentifier(other.m_OnParseUnknownIdentifier)
       , m_pJuxtapositionOperator(other.m_pJuxtapositionOperator)
+      , m_pNameIndex(other.m_pNameIndex)
       , m_TerminatorCharacters(other.m_TerminatorCharacters)
       , m_TokenCache()
   {}
@@ -216,6 +259,7 @@ namespace Text::Expression
       , m_OnParseStringCallback(std::move(other.m_OnParseStringCallback))
       , m_OnParseUnknownIdentifier(std::move(other.m_OnParseUnknownIdentifier))
       , m_pJuxtapositionOperator(std::move(other.m_pJuxtapositionOperator))
+      , m_pNameIndex(std::move(other.m_pNameIndex))
       , m_TerminatorCharacters(std::move(other.m_TerminatorCharacters))
       , m_TokenCache(std::move(other.m_TokenCache))
   {}
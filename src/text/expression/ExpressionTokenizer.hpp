@@ -1,11 +1,14 @@
 #ifndef __TEXT_EXPRESSION__EXPRESSIONTOKENIZER_HPP__
 #define __TEXT_EXPRESSION__EXPRESSIONTOKENIZER_HPP__
 
+#include "text/Common.hpp"
+#include "text/NameIndex.hpp"
 #include "text/parsing/Parser.hpp"
 
 #include <functional>
 #include <memory>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -21,18 +24,31 @@ namespace Text::Expression
   class ExpressionTokenizer : public Parsing::Parser
   {
     public:
+    using UnaryOperatorCollection  = std::unordered_map<char, IUnaryOperatorToken*>;
+    using BinaryOperatorCollection = std::unordered_map<std::string, IBinaryOperatorToken*, StringHash>;
+    using VariableCollection       = std::unordered_map<std::string, IVariableToken*, StringHash>;
+    using FunctionCollection       = std::unordered_map<std::string, IFunctionToken*, StringHash>;
+
     constexpr static char DefaultTerminatorCharacters[] = ";#";
 
     std::queue<IToken*> Execute(const std::string& expression,
-                                const std::unordered_map<char, IUnaryOperatorToken*>* unaryOperators,
-                                const std::unordered_map<std::string, IBinaryOperatorToken*>* binaryOperators,
-                                const std::unordered_map<std::string, IVariableToken*>* variables,
-                                const std::unordered_map<std::string, IFunctionToken*>* functions);
+                                const ExpressionTokenizer::UnaryOperatorCollection* unaryOperators,
+                                StringMapView<IBinaryOperatorToken*> binaryOperators,
+                                StringMapView<IVariableToken*> variables,
+                                StringMapView<IFunctionToken*> functions);
+
+    bool ExecuteNext(std::queue<IToken*>& result,
+                     const ExpressionTokenizer::UnaryOperatorCollection* unaryOperators,
+                     StringMapView<IBinaryOperatorToken*> binaryOperators,
+                     StringMapView<IVariableToken*> variables,
+                     StringMapView<IFunctionToken*> functions);
 
     void SetOnParseNumberCallback(const std::function<IValueToken*(const std::string&)>& value);
     void SetOnParseStringCallback(const std::function<IValueToken*(const std::string&)>& value);
     void SetOnUnknownIdentifierCallback(const std::function<IValueToken*(const std::string&)>& value);
     void SetJuxtapositionOperator(IBinaryOperatorToken* value);
+    const NameIndex* GetNameIndex() const;
+    void SetNameIndex(const NameIndex* value);
 
     const std::string& GetTerminatorCharacters() const;
     void SetTerminatorCharacters(const std::string& value);
@@ -49,9 +65,16 @@ namespace Text::Expression
     std::function<IValueToken*(const std::string&)> m_OnParseStringCallback;
     std::function<IValueToken*(const std::string&)> m_OnParseUnknownIdentifier;
     IBinaryOperatorToken* m_pJuxtapositionOperator;
+    const NameIndex* m_pNameIndex;
     std::string m_TerminatorCharacters;
 
     std::vector<std::unique_ptr<IToken>> m_TokenCache;
+
+    std::queue<IToken*> Tokenize(const ExpressionTokenizer::UnaryOperatorCollection* unaryOperators,
+                                 StringMapView<IBinaryOperatorToken*> binaryOperators,
+                                 StringMapView<IVariableToken*> variables,
+                                 StringMapView<IFunctionToken*> functions,
+                                 bool isLineTerminated);
   };
 } // namespace Text::Expression
 
@@ -1174,6 +1174,26 @@ namespace UnitTest
     }
   }
 
+  TEST_F(ExpressionTokenizer, Stream)
+  {
+    auto instance = createInstance();
+    std::queue<IToken*> actual;
+
+    instance.Append("10 + ");
+    ASSERT_FALSE(instance.ExecuteNext(actual, &__unaryOperators, &__binaryOperators, &__variables, &__functions));
+
+    instance.Append("3 # comment\n\n-1");
+    ASSERT_TRUE(instance.ExecuteNext(actual, &__unaryOperators, &__binaryOperators, &__variables, &__functions));
+    AssertEq(actual, Value(10.0), __binaryOperator_Addition, Value(3.0));
+    ASSERT_FALSE(instance.ExecuteNext(actual, &__unaryOperators, &__binaryOperators, &__variables, &__functions));
+
+    instance.Append("23");
+    instance.Close();
+    ASSERT_TRUE(instance.ExecuteNext(actual, &__unaryOperators, &__binaryOperators, &__variables, &__functions));
+    AssertEq(actual, __unaryOperator_Minus, Value(123.0));
+    ASSERT_FALSE(instance.ExecuteNext(actual, &__unaryOperators, &__binaryOperators, &__variables, &__functions));
+  }
+
   TEST_F(ExpressionTokenizer, Misc)
   {
     {
@@ -0,0 +1,41 @@
+#include "CompiledTemplate.hpp"
+
+namespace Text::Formatting
+{
+  bool CompiledTemplate::IsEmpty() const { return m_Nodes.empty(); }
+
+  const std::string& CompiledTemplate::GetData() const { return m_Data; }
+
+  const std::vector<CompiledTemplate::Node>& CompiledTemplate::GetNodes() const { return m_Nodes; }
+
+  std::string_view CompiledTemplate::GetText(const CompiledTemplate::Node& node) const
+  {
+    return std::string_view(m_Data.data() + node.Offset, node.Length);
+  }
+
+  std::size_t CompiledTemplate::AddLiteral(std::size_t offset)
+  {
+    m_Nodes.push_back({CompiledTemplate::NodeType::Literal, offset, m_Data.size() - offset, 0u, 1u, 0u, Parsing::Location()});
+    return m_Nodes.size() - 1u;
+  }
+
+  std::size_t CompiledTemplate::AddLiteral(std::string_view value)
+  {
+    const std::size_t offset = m_Data.size();
+    m_Data.append(value);
+    return AddLiteral(offset);
+  }
+
+  std::size_t CompiledTemplate::AddMacro(std::string_view identifier, std::size_t index, const Parsing::Location& location)
+  {
+    const std::size_t offset = m_Data.size();
+    m_Data.append(identifier);
+    m_Nodes.push_back({CompiledTemplate::NodeType::Macro, offset, identifier.length(), 0u, 1u, index, location});
+    return m_Nodes.size() - 1u;
+  }
+
+  CompiledTemplate::CompiledTemplate()
+      : m_Data()
+      , m_Nodes()
+  {}
+} // namespace Text::Formatting
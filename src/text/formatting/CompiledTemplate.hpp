@@ -0,0 +1,54 @@
+#ifndef __TEXT_FORMATTING__COMPILEDTEMPLATE_HPP__
+#define __TEXT_FORMATTING__COMPILEDTEMPLATE_HPP__
+
+#include "text/parsing/Location.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Text::Formatting
+{
+  class TextFormatter;
+
+  class CompiledTemplate
+  {
+    public:
+    enum class NodeType
+    {
+      Literal,
+      Macro
+    };
+
+    struct Node
+    {
+      NodeType Type;
+      std::size_t Offset;
+      std::size_t Length;
+      std::size_t ArgumentCount;
+      std::size_t Size;
+      std::size_t Index;
+      Parsing::Location Location;
+    };
+
+    bool IsEmpty() const;
+    const std::string& GetData() const;
+    const std::vector<CompiledTemplate::Node>& GetNodes() const;
+    std::string_view GetText(const CompiledTemplate::Node& node) const;
+
+    CompiledTemplate();
+
+    private:
+    friend class TextFormatter;
+
+    std::string m_Data;
+    std::vector<CompiledTemplate::Node> m_Nodes;
+
+    std::size_t AddLiteral(std::size_t offset);
+    std::size_t AddLiteral(std::string_view value);
+    std::size_t AddMacro(std::string_view identifier, std::size_t index, const Parsing::Location& location);
+  };
+} // namespace Text::Formatting
+
+#endif // __TEXT_FORMATTING__COMPILEDTEMPLATE_HPP__
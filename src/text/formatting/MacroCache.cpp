@@ -0,0 +1,188 @@
+#include "MacroCache.hpp"
+
+#include <iterator>
+
+namespace Text::Formatting
+{
+  MacroCache::Clock::duration MacroCache::GetLifetime(const std::string& identifier) const
+  {
+    const auto lifetime = m_Lifetimes.find(identifier);
+    return lifetime != m_Lifetimes.cend() ? lifetime->second : MacroCache::Clock::duration::zero();
+  }
+
+  void MacroCache::SetLifetime(const std::string& identifier, MacroCache::Clock::duration value)
+  {
+    Invalidate(identifier);
+    if(value > MacroCache::Clock::duration::zero())
+    {
+      m_Lifetimes[identifier] = value;
+    }
+    else
+    {
+      m_Lifetimes.erase(identifier);
+    }
+  }
+
+  std::size_t MacroCache::GetCapacity() const { return m_Capacity; }
+
+  void MacroCache::SetCapacity(std::size_t value)
+  {
+    m_Capacity = value;
+    while(m_Entries.size() > m_Capacity)
+    {
+      Erase(std::prev(m_Entries.end()));
+    }
+  }
+
+  std::size_t MacroCache::GetSize() const { return m_Entries.size(); }
+
+  std::size_t MacroCache::GetHits() const { return m_Hits; }
+
+  std::size_t MacroCache::GetMisses() const { return m_Misses; }
+
+  double MacroCache::GetHitRate() const
+  {
+    const std::size_t total = m_Hits + m_Misses;
+    return total > 0u ? static_cast<double>(m_Hits) / static_cast<double>(total) : 0.0;
+  }
+
+  std::string MacroCache::Get(const std::string& identifier, const std::vector<std::string>& args, const MacroCache::Callback& callback)
+  {
+    if(m_Lifetimes.empty() || m_Capacity == 0u)
+    {
+      return callback(args);
+    }
+
+    const auto lifetime = m_Lifetimes.find(identifier);
+    if(lifetime == m_Lifetimes.cend())
+    {
+      return callback(args);
+    }
+
+    std::string key = identifier;
+    key += '\0';
+    for(const std::string& arg : args)
+    {
+      const std::size_t length = arg.length();
+      key.append(reinterpret_cast<const char*>(&length), sizeof(length));
+      key.append(arg);
+    }
+
+    const bool isExpiring                   = lifetime->second != MacroCache::Forever;
+    const MacroCache::Clock::time_point now = isExpiring ? MacroCache::Clock::now() : MacroCache::Clock::time_point();
+    const auto entry                        = m_Index.find(key);
+    if(entry != m_Index.cend())
+    {
+      if(!isExpiring || now < entry->second->Expiry)
+      {
+        m_Hits++;
+        m_Entries.splice(m_Entries.begin(), m_Entries, entry->second);
+        return entry->second->Value;
+      }
+
+      Erase(entry->second);
+    }
+
+    m_Misses++;
+    std::string result = callback(args);
+    m_Entries.push_front({std::move(key), result, isExpiring ? now + lifetime->second : MacroCache::Clock::time_point::max()});
+    m_Index.emplace(m_Entries.front().Key, m_Entries.begin());
+    SetCapacity(m_Capacity);
+
+    return result;
+  }
+
+  void MacroCache::Invalidate(const std::string& identifier)
+  {
+    for(auto entry = m_Entries.begin(); entry != m_Entries.end();)
+    {
+      const auto current = entry++;
+      if(current->Key.compare(0u, identifier.length() + 1u, identifier.c_str(), identifier.length() + 1u) == 0)
+      {
+        Erase(current);
+      }
+    }
+  }
+
+  void MacroCache::Invalidate()
+  {
+    m_Index.clear();
+    m_Entries.clear();
+  }
+
+  void MacroCache::ResetStatistics()
+  {
+    m_Hits   = 0u;
+    m_Misses = 0u;
+  }
+
+  void MacroCache::Erase(MacroCache::EntryCollection::iterator entry)
+  {
+    m_Index.erase(entry->Key);
+    m_Entries.erase(entry);
+  }
+
+  void MacroCache::Rebuild()
+  {
+    m_Index.clear();
+    for(auto entry = m_Entries.begin(); entry != m_Entries.end(); entry++)
+    {
+      m_Index.emplace(entry->Key, entry);
+    }
+  }
+
+  MacroCache::MacroCache(std::size_t capacity)
+      : m_Lifetimes()
+      , m_Entries()
+      , m_Index()
+      , m_Capacity(capacity)
+      , m_Hits(0u)
+      , m_Misses(0u)
+  {}
+
+  MacroCache::MacroCache()
+      : MacroCache(MacroCache::DefaultCapacity)
+  {}
+
+  MacroCache::MacroCache(const MacroCache& other)
+      : m_Lifetimes(other.m_Lifetimes)
+      , m_Entries(other.m_Entries)
+      , m_Index()
+      , m_Capacity(other.m_Capacity)
+      , m_Hits(other.m_Hits)
+      , m_Misses(other.m_Misses)
+  {
+    Rebuild();
+  }
+
+  MacroCache::MacroCache(MacroCache&& other)
+      : m_Lifetimes(std::move(other.m_Lifetimes))
+      , m_Entries(std::move(other.m_Entries))
+      , m_Index(std::move(other.m_Index))
+      , m_Capacity(std::move(other.m_Capacity))
+      , m_Hits(std::move(other.m_Hits))
+      , m_Misses(std::move(other.m_Misses))
+  {}
+
+  MacroCache& MacroCache::operator=(const MacroCache& other)
+  {
+    m_Lifetimes = other.m_Lifetimes;
+    m_Entries   = other.m_Entries;
+    m_Capacity  = other.m_Capacity;
+    m_Hits      = other.m_Hits;
+    m_Misses    = other.m_Misses;
+    Rebuild();
+    return *this;
+  }
+
+  MacroCache& MacroCache::operator=(MacroCache&& other)
+  {
+    m_Lifetimes = std::move(other.m_Lifetimes);
+    m_Entries   = std::move(other.m_Entries);
+    m_Index     = std::move(other.m_Index);
+    m_Capacity  = std::move(other.m_Capacity);
+    m_Hits      = std::move(other.m_Hits);
+    m_Misses    = std::move(other.m_Misses);
+    return *this;
+  }
+} // namespace Text::Formatting
@@ -0,0 +1,72 @@
+#ifndef __TEXT_FORMATTING__MACROCACHE_HPP__
+#define __TEXT_FORMATTING__MACROCACHE_HPP__
+
+#include "text/Common.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Text::Formatting
+{
+  class MacroCache
+  {
+    public:
+    using Clock    = std::chrono::steady_clock;
+    using Callback = std::function<std::string(const std::vector<std::string>&)>;
+
+    static constexpr Clock::duration Forever     = Clock::duration::max();
+    static constexpr std::size_t DefaultCapacity = 1024u;
+
+    Clock::duration GetLifetime(const std::string& identifier) const;
+    void SetLifetime(const std::string& identifier, Clock::duration value);
+
+    std::size_t GetCapacity() const;
+    void SetCapacity(std::size_t value);
+
+    std::size_t GetSize() const;
+    std::size_t GetHits() const;
+    std::size_t GetMisses() const;
+    double GetHitRate() const;
+
+    std::string Get(const std::string& identifier, const std::vector<std::string>& args, const MacroCache::Callback& callback);
+
+    void Invalidate(const std::string& identifier);
+    void Invalidate();
+    void ResetStatistics();
+
+    MacroCache(std::size_t capacity);
+    MacroCache();
+    MacroCache(const MacroCache& other);
+    MacroCache(MacroCache&& other);
+    MacroCache& operator=(const MacroCache& other);
+    MacroCache& operator=(MacroCache&& other);
+
+    private:
+    struct Entry
+    {
+      std::string Key;
+      std::string Value;
+      Clock::time_point Expiry;
+    };
+
+    using EntryCollection = std::list<MacroCache::Entry>;
+
+    std::unordered_map<std::string, Clock::duration, StringHash> m_Lifetimes;
+    MacroCache::EntryCollection m_Entries;
+    std::unordered_map<std::string_view, MacroCache::EntryCollection::iterator, StringHash> m_Index;
+    std::size_t m_Capacity;
+    std::size_t m_Hits;
+    std::size_t m_Misses;
+
+    void Erase(MacroCache::EntryCollection::iterator entry);
+    void Rebuild();
+  };
+} // namespace Text::Formatting
+
+#endif // __TEXT_FORMATTING__MACROCACHE_HPP__
@@ -0,0 +1,24 @@
+#include "MacroRegistry.hpp"
+
+namespace Text::Formatting
+{
+  const MacroRegistry::MacroCollection& MacroRegistry::GetMacros() const { return m_Macros; }
+
+  std::size_t MacroRegistry::GetSize() const { return m_Macros.size(); }
+
+  const MacroRegistry::MacroType* MacroRegistry::Find(const std::string& identifier) const
+  {
+    const auto macro = m_Macros.find(identifier);
+    return macro != m_Macros.cend() ? &macro->second : nullptr;
+  }
+
+  bool MacroRegistry::Contains(const std::string& identifier) const { return m_Macros.find(identifier) != m_Macros.cend(); }
+
+  MacroRegistry::MacroRegistry(const MacroRegistry::MacroCollection& macros)
+      : m_Macros(macros)
+  {}
+
+  MacroRegistry::MacroRegistry(MacroRegistry::MacroCollection&& macros)
+      : m_Macros(std::move(macros))
+  {}
+} // namespace Text::Formatting
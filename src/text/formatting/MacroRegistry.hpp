@@ -0,0 +1,40 @@
+#ifndef __TEXT_FORMATTING__MACROREGISTRY_HPP__
+#define __TEXT_FORMATTING__MACROREGISTRY_HPP__
+
+#include "text/Common.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Text::Formatting
+{
+  class MacroRegistry
+  {
+    public:
+    using MacroType       = std::function<std::string(const std::vector<std::string>&)>;
+    using MacroCollection = std::unordered_map<std::string, MacroRegistry::MacroType, StringHash>;
+
+    const MacroRegistry::MacroCollection& GetMacros() const;
+    std::size_t GetSize() const;
+
+    const MacroRegistry::MacroType* Find(const std::string& identifier) const;
+    bool Contains(const std::string& identifier) const;
+
+    MacroRegistry(const MacroRegistry::MacroCollection& macros);
+    MacroRegistry(MacroRegistry::MacroCollection&& macros);
+    template<class Hash>
+    MacroRegistry(const std::unordered_map<std::string, MacroRegistry::MacroType, Hash>& macros)
+        : m_Macros(macros.cbegin(), macros.cend())
+    {}
+    MacroRegistry(const MacroRegistry&) = delete;
+    MacroRegistry& operator=(const MacroRegistry&) = delete;
+
+    private:
+    const MacroRegistry::MacroCollection m_Macros;
+  };
+} // namespace Text::Formatting
+
+#endif // __TEXT_FORMATTING__MACROREGISTRY_HPP__
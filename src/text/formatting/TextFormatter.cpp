@@ -1,10 +1,59 @@
 #include "TextFormatter.hpp"
 #include "text/exception/SyntaxError.hpp"
 
+#include <algorithm>
 #include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#ifdef IOV_MAX
+#define __TEXT_FORMATTING__TEXTFORMATTER_IOV_MAX__ IOV_MAX
+#else
+#define __TEXT_FORMATTING__TEXTFORMATTER_IOV_MAX__ 1024
+#endif
+#endif
 
 namespace Text::Formatting
 {
+#if defined(__unix__) || defined(__APPLE__)
+  static void __writeAll(int descriptor, iovec* iter, std::size_t count)
+  {
+    while(count > 0u)
+    {
+      const ssize_t result = ::writev(descriptor, iter, static_cast<int>(count));
+      if(result < 0)
+      {
+        if(errno == EINTR)
+        {
+          continue;
+        }
+
+        throw std::system_error(errno, std::generic_category(), "Error writing to descriptor: " + std::to_string(descriptor));
+      }
+
+      std::size_t written = static_cast<std::size_t>(result);
+      for(; count > 0u && written >= iter->iov_len; iter++, count--)
+      {
+        written -= iter->iov_len;
+      }
+
+      if(count > 0u)
+      {
+        iter->iov_base = static_cast<char*>(iter->iov_base) + written;
+        iter->iov_len -= written;
+      }
+    }
+  }
+#endif
+
   std::string TextFormatter::ParseValue()
   {
     std::string result;
@@ -18,7 +67,7 @@ namespace Text::Formatting
       ParseString(result);
       if(GetCurrent() != current)
       {
-        throw Exception::SyntaxError("Unterminated string: " + result, GetIndex() - result.length());
+        throw Exception::SyntaxError("Unterminated string: " + result, GetIndex() - result.length(), GetLocation(GetIndex() - result.length()));
       }
 
       Next();
@@ -29,13 +78,14 @@ namespace Text::Formatting
     return result;
   }
 
-  std::string TextFormatter::ParseExpression()
+  void TextFormatter::CompileExpression(CompiledTemplate& result)
   {
     Next(Parser::IsWhitespace);
 
     if(GetCurrent() != m_Qualifier)
     {
-      return ParseValue();
+      result.AddLiteral(ParseValue());
+      return;
     }
 
     Next();
@@ -51,70 +101,408 @@ namespace Text::Formatting
     ParseIdentifier(identifier);
     if(identifier.empty())
     {
-      throw Exception::SyntaxError("Empty identifier", GetIndex());
+      throw Exception::SyntaxError("Empty identifier", GetIndex(), GetLocation());
     }
 
-    std::vector<std::string> args;
+    const std::size_t index = GetIndex() - identifier.length();
+    const std::size_t node  = result.AddMacro(identifier, index, GetLocation(index));
     if(hasArgs)
     {
       while(GetCurrent() == ',')
       {
         Next();
-        args.push_back(ParseExpression());
+        CompileExpression(result);
+        result.m_Nodes[node].ArgumentCount++;
       }
 
       Next(Parser::IsWhitespace);
       if(GetCurrent() != '}')
       {
-        throw Exception::SyntaxError("Unterminated macro", GetIndex());
+        throw Exception::SyntaxError("Unterminated macro", GetIndex(), GetLocation());
       }
 
       Next();
     }
 
-    const auto macro = m_Macros.find(identifier);
-    if(macro == m_Macros.cend())
+    result.m_Nodes[node].Size = result.m_Nodes.size() - node;
+  }
+
+  std::string TextFormatter::RenderMacro(const CompiledTemplate& value, std::size_t index, const TextFormatter::RenderContext& context) const
+  {
+    const CompiledTemplate::Node& node = value.GetNodes()[index];
+#ifdef __cpp_lib_generic_unordered_lookup
+    const std::string_view viewIdentifier = value.GetText(node);
+#else
+    const std::string identifier(value.GetText(node));
+    const std::string& viewIdentifier = identifier;
+#endif
+    if(!m_ViewMacros.empty())
+    {
+      const auto viewMacro = m_ViewMacros.find(viewIdentifier);
+      if(viewMacro != m_ViewMacros.cend())
+      {
+        return RenderViewMacro(value, index, context, viewMacro->second);
+      }
+    }
+
+#ifdef __cpp_lib_generic_unordered_lookup
+    const std::string identifier(viewIdentifier);
+#endif
+    if(!m_LazyMacros.empty())
     {
-      if(m_OnMissingIdentifier)
+      const auto lazyMacro = m_LazyMacros.find(identifier);
+      if(lazyMacro != m_LazyMacros.cend())
       {
-        return m_OnMissingIdentifier(identifier, args);
+        return lazyMacro->second(TextFormatter::LazyArguments(*this, value, index, context));
+      }
+    }
+
+    std::vector<std::string> args(node.ArgumentCount);
+    std::size_t next = index + 1u;
+    for(std::string& arg : args)
+    {
+      next = RenderNode(value, next, arg, context);
+    }
+
+    const TextFormatter::MacroType* pMacro = nullptr;
+    const auto macro                       = m_Macros.find(identifier);
+    if(macro != m_Macros.cend())
+    {
+      pMacro = &macro->second;
+    }
+    else if(m_pRegistry != nullptr)
+    {
+      pMacro = m_pRegistry->Find(identifier);
+    }
+
+    if(pMacro != nullptr)
+    {
+      return (context.pCache != nullptr) ? context.pCache->Get(identifier, args, *pMacro) : (*pMacro)(args);
+    }
+    else if(m_OnMissingIdentifier)
+    {
+      return m_OnMissingIdentifier(identifier, args);
+    }
+    else
+    {
+      throw Exception::SyntaxError("Unkown identifier", node.Index, node.Location);
+    }
+  }
+
+  std::string TextFormatter::RenderViewMacro(const CompiledTemplate& value,
+                                             std::size_t index,
+                                             const TextFormatter::RenderContext& context,
+                                             const TextFormatter::ViewMacroType& macro) const
+  {
+    const std::size_t count = value.GetNodes()[index].ArgumentCount;
+    std::array<std::string_view, TextFormatter::InlineViewArgumentCount> inlineArgs;
+    std::array<std::string, TextFormatter::InlineViewArgumentCount> inlineResults;
+    std::vector<std::string_view> args(count > inlineArgs.size() ? count : 0u);
+    std::vector<std::string> results(count > inlineResults.size() ? count : 0u);
+    std::string_view* pArgs = args.empty() ? inlineArgs.data() : args.data();
+    std::string* pResults   = results.empty() ? inlineResults.data() : results.data();
+    std::size_t next        = index + 1u;
+    for(std::size_t i = 0u; i < count; i++)
+    {
+      const CompiledTemplate::Node& arg = value.GetNodes()[next];
+      if(arg.Type == CompiledTemplate::NodeType::Literal)
+      {
+        pArgs[i] = value.GetText(arg);
+        next++;
       }
       else
       {
-        throw Exception::SyntaxError("Unkown identifier", GetIndex() - identifier.length());
+        next     = RenderNode(value, next, pResults[i], context);
+        pArgs[i] = pResults[i];
       }
     }
 
-    return macro->second(args);
+    return macro(TextFormatter::ViewArguments(pArgs, count));
   }
 
-  std::string TextFormatter::Format(const std::string& text)
+  std::size_t TextFormatter::RenderNode(const CompiledTemplate& value,
+                                        std::size_t index,
+                                        std::string& result,
+                                        const TextFormatter::RenderContext& context) const
+  {
+    RenderPiece(value, index, context, [&result](std::string_view text, bool) { result.append(text); });
+    return index + value.GetNodes()[index].Size;
+  }
+
+  CompiledTemplate TextFormatter::Compile(const std::string& text)
   {
     SetText(text);
+    CompiledTemplate result;
+    result.m_Data.reserve(text.length());
+    result.m_Nodes.reserve(static_cast<std::size_t>(std::count(text.cbegin(), text.cend(), m_Qualifier)) * 2u + 1u);
+    std::size_t offset = 0u;
+    while(GetState())
+    {
+      const std::string_view remaining = GetRemainingText();
+      const std::size_t match          = Find(m_Qualifier);
+      const std::size_t literal        = (match != Parser::NoPos) ? match - GetIndex() : remaining.length();
+      const std::size_t qualifiers     = std::min(remaining.find_first_not_of(m_Qualifier, literal), remaining.length()) - literal;
+
+      result.m_Data.append(remaining.data(), literal);
+      result.m_Data.append(qualifiers / 2u, m_Qualifier);
+      Next(literal + qualifiers);
+      if((qualifiers % 2u) != 0)
+      {
+        if(result.m_Data.size() > offset)
+        {
+          result.AddLiteral(offset);
+        }
+
+        Prev();
+        CompileExpression(result);
+        offset = result.m_Data.size();
+      }
+    }
+
+    if(result.m_Data.size() > offset)
+    {
+      result.AddLiteral(offset);
+    }
+
+    return result;
+  }
+
+  std::string TextFormatter::Render(const CompiledTemplate& value)
+  {
     std::string result;
+    result.reserve(value.GetData().size());
+    Render(value, result);
+    return result;
+  }
+
+  void TextFormatter::Render(const CompiledTemplate& value, std::string& result)
+  {
+    RenderPieces(value, {nullptr, 0u, &m_Cache}, [&result](std::string_view text, bool) { result.append(text); });
+  }
+
+  void TextFormatter::Render(const CompiledTemplate& value, std::ostream& result)
+  {
+    RenderPieces(value, {nullptr, 0u, &m_Cache}, [&result](std::string_view text, bool) {
+      result.write(text.data(), static_cast<std::streamsize>(text.length()));
+    });
+  }
+
+  bool TextFormatter::TryRender(const CompiledTemplate& value, char* result, std::size_t size, std::size_t& length)
+  {
+    length = 0u;
+    RenderPieces(value, {nullptr, 0u, &m_Cache}, [result, size, &length](std::string_view text, bool) {
+      if(length < size)
+      {
+        std::memcpy(result + length, text.data(), std::min(text.length(), size - length));
+      }
+
+      length += text.length();
+    });
+
+    return length <= size;
+  }
+
+  std::string TextFormatter::Format(const std::string& text) { return Render(Compile(text)); }
+
+  void TextFormatter::Format(const std::string& text, std::string& result) { Render(Compile(text), result); }
+
+  void TextFormatter::Format(const std::string& text, std::ostream& result) { Render(Compile(text), result); }
+
+  bool TextFormatter::TryFormat(const std::string& text, char* result, std::size_t size, std::size_t& length)
+  {
+    return TryRender(Compile(text), result, size, length);
+  }
+
+  void TextFormatter::Write(const CompiledTemplate& value, int descriptor)
+  {
+#if defined(__unix__) || defined(__APPLE__)
+    const std::size_t batchSize     = __TEXT_FORMATTING__TEXTFORMATTER_IOV_MAX__;
+    const std::size_t pieceCapacity = std::min(value.GetNodes().size(), batchSize);
+    std::vector<iovec> pieces;
+    std::vector<std::string> results;
+    pieces.reserve(pieceCapacity);
+    results.reserve(pieceCapacity);
+    RenderPieces(value, {nullptr, 0u, &m_Cache}, [descriptor, batchSize, &pieces, &results](std::string_view text, bool isStable) {
+      if(!isStable)
+      {
+        results.emplace_back(text);
+        text = results.back();
+      }
+
+      if(!text.empty())
+      {
+        pieces.push_back({const_cast<char*>(text.data()), text.length()});
+      }
+
+      if(pieces.size() == batchSize || results.size() == batchSize)
+      {
+        __writeAll(descriptor, pieces.data(), pieces.size());
+        pieces.clear();
+        results.clear();
+      }
+    });
+
+    __writeAll(descriptor, pieces.data(), pieces.size());
+#else
+    static_cast<void>(value);
+    throw std::system_error(std::make_error_code(std::errc::function_not_supported), "Error writing to descriptor: " + std::to_string(descriptor));
+#endif
+  }
+
+  void TextFormatter::Write(const std::string& text, int descriptor) { Write(Compile(text), descriptor); }
+
+  StringColumn TextFormatter::RenderBatch(const CompiledTemplate& value, const TextFormatter::RecordCollection& records, ThreadPool& pool) const
+  {
+    const std::size_t count = !records.empty() ? records.cbegin()->second.GetSize() : 0u;
+    for(const auto& record : records)
+    {
+      if(record.second.GetSize() != count)
+      {
+        throw std::invalid_argument("Record field sizes differ: " + record.first);
+      }
+    }
+
+    const std::vector<CompiledTemplate::Node>& nodes = value.GetNodes();
+    std::vector<const StringColumn*> fields(nodes.size(), nullptr);
+    for(std::size_t i = 0u; i < nodes.size(); i++)
+    {
+      if(nodes[i].Type == CompiledTemplate::NodeType::Macro)
+      {
+        const auto field = records.find(std::string(value.GetText(nodes[i])));
+        fields[i]        = (field != records.cend()) ? &field->second : nullptr;
+      }
+    }
+
+    const std::size_t grainSize = std::max(pool.GetGrainSize() / std::max(value.GetData().size(), std::size_t(1u)), std::size_t(1u));
+    std::vector<std::string> chunks((count / grainSize) + 1u);
+    std::vector<std::pair<std::size_t, std::size_t>> ranges(chunks.size(), {0u, 0u});
+    std::vector<std::size_t> offsets(count + 1u, 0u);
+    pool.ParallelFor(count, grainSize, [this, &value, &fields, &chunks, &ranges, &offsets, grainSize](std::size_t begin, std::size_t end) {
+      std::string& chunk = chunks[begin / grainSize];
+      chunk.reserve((end - begin) * value.GetData().size());
+      for(std::size_t i = begin; i < end; i++)
+      {
+        RenderPieces(value, {&fields, i, nullptr}, [&chunk](std::string_view text, bool) { chunk.append(text); });
+
+        offsets[i + 1u] = chunk.size();
+      }
+
+      ranges[begin / grainSize] = {begin, end};
+    });
+
+    std::size_t size = 0u;
+    for(const std::string& chunk : chunks)
+    {
+      size += chunk.size();
+    }
+
+    std::string bytes;
+    bytes.reserve(size);
+    for(std::size_t i = 0u; i < chunks.size(); i++)
+    {
+      for(std::size_t j = ranges[i].first; j < ranges[i].second; j++)
+      {
+        offsets[j + 1u] += bytes.size();
+      }
+
+      bytes.append(chunks[i]);
+      std::string().swap(chunks[i]);
+    }
+
+    return StringColumn(std::move(bytes), std::move(offsets));
+  }
+
+  StringColumn TextFormatter::RenderBatch(const CompiledTemplate& value, const TextFormatter::RecordCollection& records) const
+  {
+    return RenderBatch(value, records, ThreadPool::GetDefault());
+  }
+
+  bool TextFormatter::FormatNext(std::string& result)
+  {
+    const std::size_t start = GetIndex();
+    CompiledTemplate expression;
     while(GetState())
     {
-      if(GetCurrent() == m_Qualifier)
+      const std::string_view remaining = GetRemainingText();
+      const std::size_t match          = Find(m_Qualifier);
+      const std::size_t literal        = (match != Parser::NoPos) ? match - GetIndex() : remaining.length();
+      const std::size_t qualifiers     = std::min(remaining.find_first_not_of(m_Qualifier, literal), remaining.length()) - literal;
+
+      result.append(remaining.data(), literal);
+      result.append(qualifiers / 2u, m_Qualifier);
+      if(qualifiers > 0u && literal + qualifiers == remaining.length() && IsOpen())
       {
-        std::string qualifiers;
-        Get(qualifiers, [this](char c) { return c == m_Qualifier; });
-        result.append(qualifiers.length() / 2u, m_Qualifier);
-        if((qualifiers.length() % 2u) != 0)
+        Next(literal + qualifiers - (qualifiers % 2u));
+        break;
+      }
+
+      Next(literal + qualifiers);
+      if((qualifiers % 2u) != 0)
+      {
+        Prev();
+        const Checkpoint checkpoint = GetCheckpoint();
+        expression.m_Data.clear();
+        expression.m_Nodes.clear();
+        try
+        {
+          CompileExpression(expression);
+        }
+        catch(const Exception::SyntaxError&)
+        {
+          if(!IsStarved())
+          {
+            throw;
+          }
+        }
+
+        if(IsStarved())
         {
-          Prev();
-          result.append(ParseExpression());
+          Restore(checkpoint);
+          break;
         }
+
+        Render(expression, result);
       }
-      else
+    }
+
+    Discard();
+    return GetIndex() != start;
+  }
+
+  void TextFormatter::Format(std::istream& input, std::ostream& output, std::size_t chunkSize)
+  {
+    if(chunkSize == 0u)
+    {
+      throw std::invalid_argument("Chunk size must be greater than zero");
+    }
+
+    SetText(std::string());
+    std::string chunk;
+    std::string result;
+    while(input)
+    {
+      chunk.resize(chunkSize);
+      input.read(chunk.data(), static_cast<std::streamsize>(chunkSize));
+      chunk.resize(static_cast<std::size_t>(input.gcount()));
+      if(chunk.empty())
       {
-        result += GetCurrent();
-        Next();
+        break;
       }
+
+      Append(chunk);
+      result.clear();
+      FormatNext(result);
+      output.write(result.data(), static_cast<std::streamsize>(result.length()));
     }
 
-    return result;
+    Close();
+    result.clear();
+    FormatNext(result);
+    output.write(result.data(), static_cast<std::streamsize>(result.length()));
   }
 
+  void TextFormatter::Format(std::istream& input, std::ostream& output) { Format(input, output, TextFormatter::DefaultChunkSize); }
+
   char TextFormatter::GetQualifier() const { return m_Qualifier; }
 
   void TextFormatter::SetQualifier(char value)
@@ -125,33 +513,103 @@ namespace Text::Formatting
     }
   }
 
-  std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>>& TextFormatter::GetMacros() { return m_Macros; }
+  const TextFormatter::MacroCollection& TextFormatter::GetMacros() const { return m_Macros; }
+
+  TextFormatter::MacroCollection& TextFormatter::GetMacros() { return m_Macros; }
+
+  void TextFormatter::SetMacros(const TextFormatter::MacroCollection& value)
+  {
+    m_Macros = value;
+    m_Cache.Invalidate();
+  }
+
+  void TextFormatter::SetMacro(const std::string& identifier, const TextFormatter::MacroType& value)
+  {
+    m_Macros[identifier] = value;
+    m_Cache.Invalidate(identifier);
+  }
+
+  void TextFormatter::RemoveMacro(const std::string& identifier)
+  {
+    m_Macros.erase(identifier);
+    m_Cache.Invalidate(identifier);
+  }
+
+  TextFormatter::LazyMacroCollection& TextFormatter::GetLazyMacros() { return m_LazyMacros; }
+
+  void TextFormatter::SetLazyMacros(const TextFormatter::LazyMacroCollection& value) { m_LazyMacros = value; }
+
+  TextFormatter::ViewMacroCollection& TextFormatter::GetViewMacros() { return m_ViewMacros; }
+
+  void TextFormatter::SetViewMacros(const TextFormatter::ViewMacroCollection& value) { m_ViewMacros = value; }
 
-  void TextFormatter::SetMacros(const std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>>& value) { m_Macros = value; }
+  const std::shared_ptr<const MacroRegistry>& TextFormatter::GetRegistry() const { return m_pRegistry; }
+
+  void TextFormatter::SetRegistry(const std::shared_ptr<const MacroRegistry>& value)
+  {
+    m_pRegistry = value;
+    m_Cache.Invalidate();
+  }
+
+  MacroCache& TextFormatter::GetCache() { return m_Cache; }
 
   void TextFormatter::SetOnMissingIdentifier(const std::function<std::string(const std::string&, const std::vector<std::string>&)>& value)
   {
     m_OnMissingIdentifier = value;
   }
 
-  TextFormatter::TextFormatter(char qualifier, const std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>>& macros)
+  TextFormatter::TextFormatter(char qualifier, const TextFormatter::MacroCollection& macros)
       : Parsing::Parser()
       , m_Qualifier()
       , m_Macros(macros)
+      , m_LazyMacros()
+      , m_ViewMacros()
+      , m_pRegistry()
+      , m_Cache()
   {
     SetQualifier(qualifier);
   }
 
-  TextFormatter::TextFormatter(const std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>>& macros)
+  TextFormatter::TextFormatter(const TextFormatter::MacroCollection& macros)
       : Parsing::Parser()
       , m_Qualifier(TextFormatter::DefaultQualifier)
       , m_Macros(macros)
+      , m_LazyMacros()
+      , m_ViewMacros()
+      , m_pRegistry()
+      , m_Cache()
+  {}
+
+  TextFormatter::TextFormatter(char qualifier, const std::shared_ptr<const MacroRegistry>& registry)
+      : Parsing::Parser()
+      , m_Qualifier()
+      , m_Macros()
+      , m_LazyMacros()
+      , m_ViewMacros()
+      , m_pRegistry(registry)
+      , m_Cache()
+  {
+    SetQualifier(qualifier);
+  }
+
+  TextFormatter::TextFormatter(const std::shared_ptr<const MacroRegistry>& registry)
+      : Parsing::Parser()
+      , m_Qualifier(TextFormatter::DefaultQualifier)
+      , m_Macros()
+      , m_LazyMacros()
+      , m_ViewMacros()
+      , m_pRegistry(registry)
+      , m_Cache()
   {}
 
   TextFormatter::TextFormatter(char qualifier)
       : Parsing::Parser()
       , m_Qualifier(qualifier)
       , m_Macros()
+      , m_LazyMacros()
+      , m_ViewMacros()
+      , m_pRegistry()
+      , m_Cache()
   {
     SetQualifier(qualifier);
   }
@@ -160,17 +618,87 @@ namespace Text::Formatting
       : Parsing::Parser()
       , m_Qualifier(TextFormatter::DefaultQualifier)
       , m_Macros()
+      , m_LazyMacros()
+      , m_ViewMacros()
+      , m_pRegistry()
+      , m_Cache()
   {}
 
   TextFormatter::TextFormatter(const TextFormatter& other)
       : Parsing::Parser(other)
       , m_Qualifier(other.m_Qualifier)
       , m_Macros(other.m_Macros)
+      , m_LazyMacros(other.m_LazyMacros)
+      , m_ViewMacros(other.m_ViewMacros)
+      , m_pRegistry(other.m_pRegistry)
+      , m_Cache(other.m_Cache)
+      , m_OnMissingIdentifier(other.m_OnMissingIdentifier)
   {}
 
   TextFormatter::TextFormatter(TextFormatter&& other)
       : Parsing::Parser(std::move(other))
       , m_Qualifier(std::move(other.m_Qualifier))
       , m_Macros(std::move(other.m_Macros))
+      , m_LazyMacros(std::move(other.m_LazyMacros))
+      , m_ViewMacros(std::move(other.m_ViewMacros))
+      , m_pRegistry(std::move(other.m_pRegistry))
+      , m_Cache(std::move(other.m_Cache))
+      , m_OnMissingIdentifier(std::move(other.m_OnMissingIdentifier))
+  {}
+
+  std::size_t TextFormatter::LazyArguments::GetSize() const { return m_Template.GetNodes()[m_Index].ArgumentCount; }
+
+  std::string TextFormatter::LazyArguments::Evaluate(std::size_t index) const
+  {
+    if(index >= GetSize())
+    {
+      throw std::out_of_range("Argument index out of range: " + std::to_string(index));
+    }
+
+    const std::vector<CompiledTemplate::Node>& nodes = m_Template.GetNodes();
+    std::size_t node                                 = m_Index + 1u;
+    for(std::size_t i = 0u; i < index; i++)
+    {
+      node += nodes[node].Size;
+    }
+
+    std::string result;
+    m_Formatter.RenderNode(m_Template, node, result, m_Context);
+    return result;
+  }
+
+  TextFormatter::LazyArguments::LazyArguments(const TextFormatter& formatter,
+                                              const CompiledTemplate& value,
+                                              std::size_t index,
+                                              const TextFormatter::RenderContext& context)
+      : m_Formatter(formatter)
+      , m_Template(value)
+      , m_Index(index)
+      , m_Context(context)
+  {}
+
+  std::size_t TextFormatter::ViewArguments::GetSize() const { return m_Size; }
+
+  bool TextFormatter::ViewArguments::IsEmpty() const { return m_Size == 0u; }
+
+  std::string_view TextFormatter::ViewArguments::operator[](std::size_t index) const { return m_pData[index]; }
+
+  std::string_view TextFormatter::ViewArguments::At(std::size_t index) const
+  {
+    if(index >= m_Size)
+    {
+      throw std::out_of_range("Argument index out of range: " + std::to_string(index));
+    }
+
+    return m_pData[index];
+  }
+
+  const std::string_view* TextFormatter::ViewArguments::begin() const { return m_pData; }
+
+  const std::string_view* TextFormatter::ViewArguments::end() const { return m_pData + m_Size; }
+
+  TextFormatter::ViewArguments::ViewArguments(const std::string_view* data, std::size_t size)
+      : m_pData(data)
+      , m_Size(size)
   {}
 } // namespace Text::Formatting
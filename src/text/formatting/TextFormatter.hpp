@@ -1,8 +1,21 @@
 #ifndef __TEXT_FORMATTING__TEXTFORMATTER_HPP__
 #define __TEXT_FORMATTING__TEXTFORMATTER_HPP__
 
+#include "CompiledTemplate.hpp"
+#include "MacroCache.hpp"
+#include "MacroRegistry.hpp"
+#include "text/Common.hpp"
+#include "text/StringColumn.hpp"
+#include "text/ThreadPool.hpp"
 #include "text/parsing/Parser.hpp"
 
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -11,20 +24,98 @@ namespace Text::Formatting
   class TextFormatter : protected Parsing::Parser
   {
     public:
-    static const char DefaultQualifier = '$';
+    class LazyArguments;
+    class ViewArguments;
+
+    using MacroType           = MacroRegistry::MacroType;
+    using MacroCollection     = MacroRegistry::MacroCollection;
+    using LazyMacroType       = std::function<std::string(const TextFormatter::LazyArguments&)>;
+    using LazyMacroCollection = std::unordered_map<std::string, TextFormatter::LazyMacroType, StringHash>;
+    using ViewMacroType       = std::function<std::string(const TextFormatter::ViewArguments&)>;
+    using ViewMacroCollection = std::unordered_map<std::string, TextFormatter::ViewMacroType, StringHash, std::equal_to<>>;
+    using RecordCollection    = std::unordered_map<std::string, StringColumn, StringHash>;
+
+    static const char DefaultQualifier               = '$';
+    static const std::size_t DefaultChunkSize        = 65536u;
+    static const std::size_t InlineViewArgumentCount = 8u;
+
+    using Parsing::Parser::Append;
+    using Parsing::Parser::Close;
+
+    CompiledTemplate Compile(const std::string& text);
+
+    std::string Render(const CompiledTemplate& value);
+    void Render(const CompiledTemplate& value, std::string& result);
+    void Render(const CompiledTemplate& value, std::ostream& result);
+    bool TryRender(const CompiledTemplate& value, char* result, std::size_t size, std::size_t& length);
+
+    template<class OutputIterator, class = std::enable_if_t<!std::is_base_of_v<std::ostream, OutputIterator>>>
+    OutputIterator Render(const CompiledTemplate& value, OutputIterator result)
+    {
+      RenderPieces(value, {nullptr, 0u, &m_Cache}, [&result](std::string_view text, bool) { result = std::copy(text.cbegin(), text.cend(), result); });
+      return result;
+    }
+
+    void Write(const CompiledTemplate& value, int descriptor);
+    void Write(const std::string& text, int descriptor);
+
+    StringColumn RenderBatch(const CompiledTemplate& value, const TextFormatter::RecordCollection& records, ThreadPool& pool) const;
+    StringColumn RenderBatch(const CompiledTemplate& value, const TextFormatter::RecordCollection& records) const;
 
     std::string Format(const std::string& text);
+    void Format(const std::string& text, std::string& result);
+    void Format(const std::string& text, std::ostream& result);
+    bool TryFormat(const std::string& text, char* result, std::size_t size, std::size_t& length);
+
+    bool FormatNext(std::string& result);
+    void Format(std::istream& input, std::ostream& output, std::size_t chunkSize);
+    void Format(std::istream& input, std::ostream& output);
+
+    template<class OutputIterator, class = std::enable_if_t<!std::is_base_of_v<std::ostream, OutputIterator>>>
+    OutputIterator Format(const std::string& text, OutputIterator result)
+    {
+      return Render(Compile(text), result);
+    }
 
     char GetQualifier() const;
     void SetQualifier(char value);
 
-    std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>>& GetMacros();
-    void SetMacros(const std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>>& value);
+    const TextFormatter::MacroCollection& GetMacros() const;
+    TextFormatter::MacroCollection& GetMacros();
+    void SetMacros(const TextFormatter::MacroCollection& value);
+    template<class Hash>
+    void SetMacros(const std::unordered_map<std::string, TextFormatter::MacroType, Hash>& value)
+    {
+      SetMacros(TextFormatter::MacroCollection(value.cbegin(), value.cend()));
+    }
+    void SetMacro(const std::string& identifier, const TextFormatter::MacroType& value);
+    void RemoveMacro(const std::string& identifier);
+
+    TextFormatter::LazyMacroCollection& GetLazyMacros();
+    void SetLazyMacros(const TextFormatter::LazyMacroCollection& value);
+
+    TextFormatter::ViewMacroCollection& GetViewMacros();
+    void SetViewMacros(const TextFormatter::ViewMacroCollection& value);
+
+    const std::shared_ptr<const MacroRegistry>& GetRegistry() const;
+    void SetRegistry(const std::shared_ptr<const MacroRegistry>& value);
+
+    MacroCache& GetCache();
 
     void SetOnMissingIdentifier(const std::function<std::string(const std::string&, const std::vector<std::string>&)>& value);
 
-    TextFormatter(char qualifier, const std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>>& macros);
-    TextFormatter(const std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>>& macros);
+    TextFormatter(char qualifier, const TextFormatter::MacroCollection& macros);
+    TextFormatter(const TextFormatter::MacroCollection& macros);
+    template<class Hash>
+    TextFormatter(char qualifier, const std::unordered_map<std::string, TextFormatter::MacroType, Hash>& macros)
+        : TextFormatter(qualifier, TextFormatter::MacroCollection(macros.cbegin(), macros.cend()))
+    {}
+    template<class Hash>
+    TextFormatter(const std::unordered_map<std::string, TextFormatter::MacroType, Hash>& macros)
+        : TextFormatter(TextFormatter::MacroCollection(macros.cbegin(), macros.cend()))
+    {}
+    TextFormatter(char qualifier, const std::shared_ptr<const MacroRegistry>& registry);
+    TextFormatter(const std::shared_ptr<const MacroRegistry>& registry);
     TextFormatter(char qualifier);
     ~TextFormatter() override = default;
     TextFormatter();
@@ -32,12 +123,96 @@ namespace Text::Formatting
     TextFormatter(TextFormatter&& other);
 
     private:
+    struct RenderContext
+    {
+      const std::vector<const StringColumn*>* pFields;
+      std::size_t Record;
+      MacroCache* pCache;
+    };
+
     char m_Qualifier;
-    std::unordered_map<std::string, std::function<std::string(const std::vector<std::string>&)>> m_Macros;
+    TextFormatter::MacroCollection m_Macros;
+    TextFormatter::LazyMacroCollection m_LazyMacros;
+    TextFormatter::ViewMacroCollection m_ViewMacros;
+    std::shared_ptr<const MacroRegistry> m_pRegistry;
+    MacroCache m_Cache;
     std::function<std::string(const std::string&, const std::vector<std::string>&)> m_OnMissingIdentifier;
 
     std::string ParseValue();
-    std::string ParseExpression();
+    void CompileExpression(CompiledTemplate& result);
+    std::string RenderMacro(const CompiledTemplate& value, std::size_t index, const TextFormatter::RenderContext& context) const;
+    std::string RenderViewMacro(const CompiledTemplate& value,
+                                std::size_t index,
+                                const TextFormatter::RenderContext& context,
+                                const TextFormatter::ViewMacroType& macro) const;
+    std::size_t RenderNode(const CompiledTemplate& value, std::size_t index, std::string& result, const TextFormatter::RenderContext& context) const;
+
+    template<class Callback>
+    void RenderPiece(const CompiledTemplate& value, std::size_t index, const TextFormatter::RenderContext& context, const Callback& callback) const
+    {
+      const CompiledTemplate::Node& node = value.GetNodes()[index];
+      if(node.Type == CompiledTemplate::NodeType::Literal)
+      {
+        callback(value.GetText(node), true);
+      }
+      else if(context.pFields != nullptr && (*context.pFields)[index] != nullptr)
+      {
+        callback((*(*context.pFields)[index])[context.Record], true);
+      }
+      else
+      {
+        const std::string text = RenderMacro(value, index, context);
+        callback(std::string_view(text), false);
+      }
+    }
+
+    template<class Callback>
+    void RenderPieces(const CompiledTemplate& value, const TextFormatter::RenderContext& context, const Callback& callback) const
+    {
+      const std::vector<CompiledTemplate::Node>& nodes = value.GetNodes();
+      for(std::size_t i = 0u; i < nodes.size(); i += nodes[i].Size)
+      {
+        RenderPiece(value, i, context, callback);
+      }
+    }
+  };
+
+  class TextFormatter::LazyArguments
+  {
+    public:
+    std::size_t GetSize() const;
+    std::string Evaluate(std::size_t index) const;
+
+    private:
+    friend class TextFormatter;
+
+    LazyArguments(const TextFormatter& formatter, const CompiledTemplate& value, std::size_t index, const TextFormatter::RenderContext& context);
+
+    const TextFormatter& m_Formatter;
+    const CompiledTemplate& m_Template;
+    std::size_t m_Index;
+    const TextFormatter::RenderContext& m_Context;
+  };
+
+  class TextFormatter::ViewArguments
+  {
+    public:
+    std::size_t GetSize() const;
+    bool IsEmpty() const;
+
+    std::string_view operator[](std::size_t index) const;
+    std::string_view At(std::size_t index) const;
+
+    const std::string_view* begin() const;
+    const std::string_view* end() const;
+
+    private:
+    friend class TextFormatter;
+
+    ViewArguments(const std::string_view* data, std::size_t size);
+
+    const std::string_view* m_pData;
+    std::size_t m_Size;
   };
 } // namespace Text::Formatting
 
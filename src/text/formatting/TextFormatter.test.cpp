@@ -1,7 +1,20 @@
 #include "TextFormatter.hpp"
+#include "text/exception/SyntaxError.hpp"
 
+#include <cctype>
+#include <chrono>
 #include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
 
 #include <gtest/gtest.h>
 
@@ -68,3 +81,474 @@ TEST(testTextFormatter, testFormat)
   ASSERT_EQ(formatter.Format("value=${cmd, \"test\"}"), "value=test");
   ASSERT_EQ(formatter.Format("value=${cmd, \"null\"}"), "value=<N/A>");
 }
+
+TEST(testTextFormatter, testCompile)
+{
+  TextFormatter formatter('$');
+  formatter.GetMacros()["test"] = [](const std::vector<std::string>& args) {
+    static_cast<void>(args);
+    return "abc 123";
+  };
+
+  formatter.GetMacros()["strlen"] = [](const std::vector<std::string>& args) { return std::to_string(args[0].length()); };
+
+  const CompiledTemplate compiled = formatter.Compile("a=$$${strlen, ${test}} b=${nargs, \"x\", $test, 1} c=$test");
+  ASSERT_EQ(compiled.GetNodes().size(), 10u);
+  ASSERT_EQ(compiled.GetText(compiled.GetNodes()[0]), "a=$");
+  ASSERT_EQ(compiled.GetText(compiled.GetNodes()[1]), "strlen");
+  ASSERT_EQ(compiled.GetNodes()[1].ArgumentCount, 1u);
+  ASSERT_EQ(compiled.GetNodes()[1].Size, 2u);
+  ASSERT_EQ(compiled.GetNodes()[4].Index, 27u);
+
+  ASSERT_THROW(formatter.Render(compiled), Text::Exception::SyntaxError);
+
+  formatter.GetMacros()["nargs"] = [](const std::vector<std::string>& args) { return std::to_string(args.size()) + args[1]; };
+  ASSERT_EQ(formatter.Render(compiled), "a=$7 b=3abc 123 c=abc 123");
+  ASSERT_EQ(formatter.Render(compiled), formatter.Format("a=$$${strlen, ${test}} b=${nargs, \"x\", $test, 1} c=$test"));
+
+  formatter.GetMacros()["test"] = [](const std::vector<std::string>& args) { return std::to_string(args.size()); };
+  ASSERT_EQ(formatter.Render(compiled), "a=$1 b=30 c=0");
+
+  ASSERT_TRUE(formatter.Compile("").IsEmpty());
+  ASSERT_EQ(formatter.Render(formatter.Compile("$$ $$")), "$ $");
+  ASSERT_THROW(formatter.Compile("${strlen, \"abc"), Text::Exception::SyntaxError);
+  ASSERT_THROW(formatter.Compile("${strlen, 1"), Text::Exception::SyntaxError);
+  ASSERT_THROW(formatter.Compile("${}"), Text::Exception::SyntaxError);
+}
+
+TEST(testTextFormatter, testOutput)
+{
+  TextFormatter formatter('$');
+  formatter.GetMacros()["test"] = [](const std::vector<std::string>& args) {
+    static_cast<void>(args);
+    return "abc 123";
+  };
+
+  formatter.GetMacros()["strlen"] = [](const std::vector<std::string>& args) { return std::to_string(args[0].length()); };
+
+  const CompiledTemplate compiled = formatter.Compile("value=$test, ${strlen, $test}");
+
+  std::string result = "> ";
+  formatter.Render(compiled, result);
+  formatter.Format("; $$", result);
+  ASSERT_EQ(result, "> value=abc 123, 7; $");
+
+  std::ostringstream stream;
+  formatter.Render(compiled, stream);
+  formatter.Format("!", stream);
+  ASSERT_EQ(stream.str(), "value=abc 123, 7!");
+
+  std::vector<char> characters;
+  formatter.Render(compiled, std::back_inserter(characters));
+  ASSERT_EQ(std::string(characters.cbegin(), characters.cend()), "value=abc 123, 7");
+
+  char buffer[32];
+  std::size_t length;
+  ASSERT_TRUE(formatter.TryRender(compiled, buffer, sizeof(buffer), length));
+  ASSERT_EQ(std::string(buffer, length), "value=abc 123, 7");
+  ASSERT_FALSE(formatter.TryRender(compiled, buffer, 10u, length));
+  ASSERT_EQ(length, 16u);
+  ASSERT_EQ(std::string(buffer, 10u), "value=abc ");
+  ASSERT_TRUE(formatter.TryFormat("$test", buffer, 7u, length));
+  ASSERT_EQ(std::string(buffer, length), "abc 123");
+  ASSERT_FALSE(formatter.TryFormat("$test", nullptr, 0u, length));
+  ASSERT_EQ(length, 7u);
+}
+
+TEST(testTextFormatter, testLiterals)
+{
+  TextFormatter formatter('$');
+  formatter.GetMacros()["x"] = [](const std::vector<std::string>& args) { return std::to_string(args.size()); };
+
+  ASSERT_EQ(formatter.Format("$$"), "$");
+  ASSERT_EQ(formatter.Format("$$$$x$$$$$x$$"), "$$x$$0$");
+  ASSERT_EQ(formatter.Format("a$$$$$$${x, 1}b"), "a$$$1b");
+  ASSERT_THROW(formatter.Format("abc$"), Text::Exception::SyntaxError);
+
+  std::string body;
+  std::string expected;
+  for(std::size_t i = 0u; i < 1000u; i++)
+  {
+    body += "<p class=\"row\">" + std::string(i % 5u, '$') + "x</p>\n";
+    expected += "<p class=\"row\">" + std::string((i % 5u) / 2u, '$') + ((i % 5u) % 2u != 0u ? "0" : "x") + "</p>\n";
+  }
+
+  ASSERT_EQ(formatter.Format(body), expected);
+
+  const CompiledTemplate compiled = formatter.Compile("<html>" + std::string(4096u, ' ') + "$x</html>");
+  ASSERT_EQ(compiled.GetNodes().size(), 3u);
+  ASSERT_EQ(compiled.GetNodes()[0].Length, 4102u);
+}
+
+TEST(testTextFormatter, testCache)
+{
+  std::size_t calls = 0u;
+  TextFormatter formatter('$');
+  formatter.GetMacros()["count"] = [&calls](const std::vector<std::string>& args) {
+    calls++;
+    return std::to_string(args.size());
+  };
+
+  ASSERT_EQ(formatter.Format("$count $count"), "0 0");
+  ASSERT_EQ(calls, 2u);
+  ASSERT_EQ(formatter.GetCache().GetHits() + formatter.GetCache().GetMisses(), 0u);
+
+  formatter.GetCache().SetLifetime("count", MacroCache::Forever);
+  ASSERT_EQ(formatter.Format("$count ${count, 1} ${count, \"1\"} ${count, 1, 2} $count"), "0 1 1 2 0");
+  ASSERT_EQ(calls, 5u);
+  ASSERT_EQ(formatter.GetCache().GetSize(), 3u);
+  ASSERT_EQ(formatter.GetCache().GetHits(), 2u);
+  ASSERT_EQ(formatter.GetCache().GetMisses(), 3u);
+  ASSERT_DOUBLE_EQ(formatter.GetCache().GetHitRate(), 0.4);
+
+  formatter.GetCache().SetCapacity(2u);
+  ASSERT_EQ(formatter.GetCache().GetSize(), 2u);
+  ASSERT_EQ(formatter.Format("$count"), "0");
+  ASSERT_EQ(formatter.Format("${count, 1}"), "1");
+  ASSERT_EQ(calls, 6u);
+
+  TextFormatter copy(formatter);
+  ASSERT_EQ(copy.Format("$count"), "0");
+  ASSERT_EQ(calls, 6u);
+
+  formatter.GetCache().Invalidate("count");
+  ASSERT_EQ(formatter.GetCache().GetSize(), 0u);
+  ASSERT_EQ(formatter.Format("$count"), "0");
+  ASSERT_EQ(calls, 7u);
+
+  formatter.GetCache().SetLifetime("count", std::chrono::hours(1));
+  ASSERT_EQ(formatter.Format("$count $count"), "0 0");
+  ASSERT_EQ(calls, 8u);
+
+  formatter.GetCache().SetLifetime("count", std::chrono::nanoseconds(1));
+  ASSERT_EQ(formatter.Format("$count"), "0");
+  std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  ASSERT_EQ(formatter.Format("$count"), "0");
+  ASSERT_EQ(calls, 10u);
+
+  formatter.GetCache().SetLifetime("count", MacroCache::Clock::duration::zero());
+  ASSERT_EQ(formatter.GetCache().GetLifetime("count"), MacroCache::Clock::duration::zero());
+  formatter.GetCache().ResetStatistics();
+  ASSERT_EQ(formatter.Format("$count $count"), "0 0");
+  ASSERT_EQ(calls, 12u);
+  ASSERT_EQ(formatter.GetCache().GetMisses(), 0u);
+
+  formatter.GetCache().SetLifetime("count", MacroCache::Forever);
+  ASSERT_EQ(formatter.Format("${count, 1}"), "1");
+  ASSERT_EQ(formatter.GetCache().GetSize(), 1u);
+  formatter.SetMacro("count", [](const std::vector<std::string>& args) { return std::to_string(args.size() * 10u); });
+  ASSERT_EQ(formatter.GetCache().GetSize(), 0u);
+  ASSERT_EQ(formatter.Format("${count, 1}"), "10");
+  ASSERT_EQ(calls, 13u);
+
+  ASSERT_EQ(formatter.GetCache().GetSize(), 1u);
+  formatter.RemoveMacro("count");
+  ASSERT_EQ(formatter.GetCache().GetSize(), 0u);
+  ASSERT_THROW(formatter.Format("${count, 1}"), Text::Exception::SyntaxError);
+}
+
+TEST(testTextFormatter, testStream)
+{
+  TextFormatter formatter('$');
+  formatter.GetMacros()["test"] = [](const std::vector<std::string>& args) {
+    static_cast<void>(args);
+    return "abc 123";
+  };
+
+  formatter.GetMacros()["join"] = [](const std::vector<std::string>& args) {
+    std::string result;
+    for(const auto& i : args)
+    {
+      result += i;
+    }
+
+    return result;
+  };
+
+  std::string input;
+  for(std::size_t i = 0u; i < 20u; i++)
+  {
+    input += "line " + std::to_string(i) + ": $$ $$$test ${join, \"a b\", $test, 12, ${join, 7}} $$$$${ test }.\n";
+  }
+
+  const std::string expected = formatter.Format(input);
+  for(std::size_t chunkSize = 1u; chunkSize <= 64u; chunkSize++)
+  {
+    std::istringstream stream(input);
+    std::ostringstream result;
+    formatter.Format(stream, result, chunkSize);
+    ASSERT_EQ(result.str(), expected);
+  }
+
+  std::string result;
+  formatter.Append("a=$te");
+  ASSERT_TRUE(formatter.FormatNext(result));
+  ASSERT_EQ(result, "a=");
+  ASSERT_FALSE(formatter.FormatNext(result));
+  formatter.Append("st, b=${join, \"x");
+  ASSERT_TRUE(formatter.FormatNext(result));
+  ASSERT_EQ(result, "a=abc 123, b=");
+  formatter.Append("\", 1} $");
+  ASSERT_TRUE(formatter.FormatNext(result));
+  ASSERT_EQ(result, "a=abc 123, b=x1 ");
+  formatter.Append("$ c=$test");
+  formatter.Close();
+  ASSERT_TRUE(formatter.FormatNext(result));
+  ASSERT_EQ(result, "a=abc 123, b=x1 $ c=abc 123");
+
+  std::istringstream unterminated("abc ${join, 1, 2");
+  std::ostringstream output;
+  ASSERT_THROW(formatter.Format(unterminated, output, 4u), Text::Exception::SyntaxError);
+  ASSERT_EQ(output.str(), "abc ");
+
+  std::istringstream empty;
+  ASSERT_THROW(formatter.Format(empty, output, 0u), std::invalid_argument);
+}
+
+TEST(testTextFormatter, testRegistry)
+{
+  TextFormatter::MacroCollection macros;
+  macros["test"]   = [](const std::vector<std::string>& args) { return "abc " + std::to_string(args.size()); };
+  macros["strlen"] = [](const std::vector<std::string>& args) { return std::to_string(args[0].length()); };
+  const auto registry = std::make_shared<const MacroRegistry>(std::move(macros));
+  ASSERT_EQ(registry->GetSize(), 2u);
+  ASSERT_TRUE(registry->Contains("test"));
+  ASSERT_EQ(registry->Find("void"), nullptr);
+
+  TextFormatter formatter(registry);
+  ASSERT_EQ(formatter.Format("$test ${strlen, $test}"), "abc 0 5");
+  ASSERT_THROW(formatter.Format("$void"), Text::Exception::SyntaxError);
+
+  formatter.GetMacros()["test"] = [](const std::vector<std::string>& args) { return std::to_string(args.size()); };
+  ASSERT_EQ(formatter.Format("$test ${strlen, $test}"), "0 1");
+  ASSERT_EQ(TextFormatter('%', registry).Format("%test"), "abc 0");
+
+  std::unordered_map<std::string, TextFormatter::MacroType> legacyMacros;
+  legacyMacros["test"] = [](const std::vector<std::string>& args) { return "legacy " + std::to_string(args.size()); };
+  ASSERT_EQ(MacroRegistry(legacyMacros).GetSize(), 1u);
+  ASSERT_EQ(TextFormatter('%', legacyMacros).Format("%test"), "legacy 0");
+  formatter.SetMacros(legacyMacros);
+  ASSERT_EQ(formatter.Format("$test ${strlen, $test}"), "legacy 0 8");
+
+  const CompiledTemplate compiled = formatter.Compile("${strlen, \"12345\"}-${test, 1, 2}");
+  std::vector<std::string> results(4u);
+  std::vector<std::thread> threads;
+  for(std::size_t i = 0u; i < results.size(); i++)
+  {
+    threads.emplace_back([&registry, &compiled, &results, i]() {
+      TextFormatter local(registry);
+      for(std::size_t j = 0u; j < 1000u; j++)
+      {
+        results[i] = local.Render(compiled);
+      }
+    });
+  }
+
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  for(const auto& result : results)
+  {
+    ASSERT_EQ(result, "5-abc 2");
+  }
+
+  formatter.SetOnMissingIdentifier([](const std::string& id, const std::vector<std::string>& args) { return id + std::to_string(args.size()); });
+  TextFormatter copy(formatter);
+  ASSERT_EQ(copy.Format("$void"), "void0");
+  copy.SetRegistry(nullptr);
+  ASSERT_EQ(copy.Format("$strlen"), "strlen0");
+}
+
+TEST(testTextFormatter, testRenderBatch)
+{
+  TextFormatter formatter('$');
+  formatter.GetMacros()["upper"] = [](const std::vector<std::string>& args) {
+    std::string result = args[0];
+    for(auto& i : result)
+    {
+      i = static_cast<char>(std::toupper(static_cast<unsigned char>(i)));
+    }
+
+    return result;
+  };
+
+  std::vector<std::string> names;
+  std::vector<std::string> amounts;
+  for(std::size_t i = 0u; i < 1000u; i++)
+  {
+    names.push_back("name" + std::to_string(i));
+    amounts.push_back(std::to_string(i * 7u));
+  }
+
+  TextFormatter::RecordCollection records;
+  records.emplace("name", Text::StringColumn(names));
+  records.emplace("amount", Text::StringColumn(amounts));
+
+  const CompiledTemplate compiled = formatter.Compile("Dear ${upper, $name}, you owe $$$amount today.");
+  Text::ThreadPool pool(3u);
+  pool.SetGrainSize(64u);
+  const Text::StringColumn result = formatter.RenderBatch(compiled, records, pool);
+  ASSERT_EQ(result.GetSize(), 1000u);
+  for(std::size_t i = 0u; i < result.GetSize(); i++)
+  {
+    ASSERT_EQ(result[i], "Dear NAME" + std::to_string(i) + ", you owe $" + std::to_string(i * 7u) + " today.");
+  }
+
+  ASSERT_EQ(formatter.RenderBatch(compiled, records).GetBytes(), result.GetBytes());
+  ASSERT_EQ(formatter.RenderBatch(compiled, TextFormatter::RecordCollection()).GetSize(), 0u);
+
+  records.emplace("short", Text::StringColumn(std::vector<std::string>(3u, "x")));
+  ASSERT_THROW(formatter.RenderBatch(compiled, records, pool), std::invalid_argument);
+  records.erase("short");
+
+  records.erase("amount");
+  ASSERT_THROW(formatter.RenderBatch(compiled, records, pool), Text::Exception::SyntaxError);
+}
+
+TEST(testTextFormatter, testRenderBatchNested)
+{
+  Text::ThreadPool pool(2u);
+  pool.SetGrainSize(64u);
+  Text::ThreadPool& defaultPool      = Text::ThreadPool::GetDefault();
+  const std::size_t defaultGrainSize = defaultPool.GetGrainSize();
+  defaultPool.SetGrainSize(64u);
+
+  TextFormatter formatter('$');
+  formatter.GetMacros()["trim"] = [&pool](const std::vector<std::string>& args) {
+    const Text::StringColumn values(std::vector<std::string>(256u, "  " + args[0] + "  "));
+    return std::to_string(Text::Trim(values, pool).GetBytes().size());
+  };
+  formatter.GetMacros()["trimDefault"] = [](const std::vector<std::string>& args) {
+    const Text::StringColumn values(std::vector<std::string>(256u, "  " + args[0] + "  "));
+    return std::to_string(Text::Trim(values).GetBytes().size());
+  };
+
+  TextFormatter::RecordCollection records;
+  records.emplace("name", Text::StringColumn(std::vector<std::string>(64u, "ab")));
+
+  const Text::StringColumn result = formatter.RenderBatch(formatter.Compile("${trim, $name}"), records, pool);
+  ASSERT_EQ(result.GetSize(), 64u);
+  ASSERT_EQ(result[63u], "512");
+
+  const Text::StringColumn defaultResult = formatter.RenderBatch(formatter.Compile("${trimDefault, $name}"), records);
+  ASSERT_EQ(defaultResult.GetSize(), 64u);
+  ASSERT_EQ(defaultResult[63u], "512");
+
+  defaultPool.SetGrainSize(defaultGrainSize);
+}
+
+TEST(testTextFormatter, testLazyMacros)
+{
+  std::size_t calls = 0u;
+  TextFormatter formatter('$');
+  formatter.GetMacros()["expensive"] = [&calls](const std::vector<std::string>& args) {
+    calls++;
+    return "expensive" + std::to_string(args.size());
+  };
+
+  formatter.GetMacros()["flag"] = [](const std::vector<std::string>& args) { return args.empty() ? "" : args[0]; };
+
+  formatter.GetLazyMacros()["if"] = [](const TextFormatter::LazyArguments& args) {
+    return !args.Evaluate(0u).empty() ? args.Evaluate(1u) : args.Evaluate(2u);
+  };
+
+  formatter.GetLazyMacros()["nargs"] = [](const TextFormatter::LazyArguments& args) { return std::to_string(args.GetSize()); };
+
+  ASSERT_EQ(formatter.Format("${if, $flag, ${expensive}, \"x\"}"), "x");
+  ASSERT_EQ(calls, 0u);
+  ASSERT_EQ(formatter.Format("${if, ${flag, 1}, ${expensive, 1, 2}, \"x\"}"), "expensive2");
+  ASSERT_EQ(calls, 1u);
+  ASSERT_EQ(formatter.Format("${if, ${flag, 1}, ${if, $flag, $expensive, ${nargs, $expensive, 1}}, $expensive}"), "2");
+  ASSERT_EQ(calls, 1u);
+  ASSERT_EQ(formatter.Format("$nargs"), "0");
+  ASSERT_THROW(formatter.Format("${if, 1}"), std::out_of_range);
+
+  TextFormatter::RecordCollection records;
+  records.emplace("name", Text::StringColumn(std::vector<std::string> {"a", "", "c"}));
+  const Text::StringColumn result = formatter.RenderBatch(formatter.Compile("${if, $name, $name, \"-\"}"), records);
+  ASSERT_EQ(result.GetBytes(), "a-c");
+  ASSERT_EQ(calls, 1u);
+}
+
+TEST(testTextFormatter, testViewMacros)
+{
+  TextFormatter formatter('$');
+  formatter.GetMacros()["test"] = [](const std::vector<std::string>& args) {
+    static_cast<void>(args);
+    return "abc 123";
+  };
+
+  const char* pData = nullptr;
+  std::size_t size  = 0u;
+  formatter.GetViewMacros()["strlen"] = [&pData, &size](const TextFormatter::ViewArguments& args) {
+    pData = args[0].data();
+    size  = args.GetSize();
+    return std::to_string(args.At(0u).length());
+  };
+
+  formatter.GetViewMacros()["join"] = [](const TextFormatter::ViewArguments& args) {
+    std::string result;
+    for(const auto& i : args)
+    {
+      result += i;
+    }
+
+    return result;
+  };
+
+  const CompiledTemplate compiled = formatter.Compile("${strlen, \"12345\", 1}");
+  ASSERT_EQ(formatter.Render(compiled), "5");
+  ASSERT_EQ(size, 2u);
+  ASSERT_GE(pData, compiled.GetData().data());
+  ASSERT_LT(pData, compiled.GetData().data() + compiled.GetData().size());
+
+  ASSERT_EQ(formatter.Format("${strlen, $test}"), "7");
+  ASSERT_EQ(formatter.Format("${join, 1, $test, \"x\", ${join, 2, 3}, 4, 5, 6, 7, 8, 9, $test}"), "1abc 123x23456789abc 123");
+  ASSERT_EQ(formatter.Format("$join"), "");
+  ASSERT_THROW(formatter.Format("$strlen"), std::out_of_range);
+
+  formatter.GetMacros()["join"] = [](const std::vector<std::string>& args) { return std::to_string(args.size()); };
+  ASSERT_EQ(formatter.Format("${join, 1, 2}"), "12");
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(testTextFormatter, testWrite)
+{
+  TextFormatter formatter('$');
+  formatter.GetMacros()["index"] = [](const std::vector<std::string>& args) { return args[0]; };
+  formatter.GetMacros()["empty"] = [](const std::vector<std::string>& args) {
+    static_cast<void>(args);
+    return "";
+  };
+
+  std::string text;
+  for(std::size_t i = 0u; i < 3000u; i++)
+  {
+    text += "<li>${index, " + std::to_string(i) + "}$empty</li>\n";
+  }
+
+  int descriptors[2];
+  ASSERT_EQ(pipe(descriptors), 0);
+
+  std::string result;
+  std::thread reader([&result, &descriptors]() {
+    char buffer[4096];
+    ssize_t count;
+    while((count = read(descriptors[0], buffer, sizeof(buffer))) > 0)
+    {
+      result.append(buffer, static_cast<std::size_t>(count));
+    }
+  });
+
+  formatter.Write(text, descriptors[1]);
+  formatter.Write(formatter.Compile("$$end"), descriptors[1]);
+  close(descriptors[1]);
+  reader.join();
+  close(descriptors[0]);
+
+  ASSERT_EQ(result, formatter.Format(text) + "$end");
+  ASSERT_THROW(formatter.Write(text, -1), std::system_error);
+}
+#endif
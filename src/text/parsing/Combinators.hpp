@@ -0,0 +1,227 @@
+#ifndef __TEXT_PARSING__COMBINATORS_HPP__
+#define __TEXT_PARSING__COMBINATORS_HPP__
+
+#include "ParserBase.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace Text::Parsing::Combinators
+{
+  using CaptureCollection = std::vector<std::string_view>;
+
+  template<class Predicate>
+  struct CharClass
+  {
+    static bool Match(const char*& iter, const char* end, CaptureCollection*)
+    {
+      if(iter == end || !Predicate::Test(*iter))
+      {
+        return false;
+      }
+
+      iter++;
+      return true;
+    }
+  };
+
+  template<char... Characters>
+  struct Literal
+  {
+    static bool Match(const char*& iter, const char* end, CaptureCollection*)
+    {
+      constexpr char characters[] = {Characters...};
+      if(static_cast<std::size_t>(end - iter) < sizeof...(Characters))
+      {
+        return false;
+      }
+
+      for(std::size_t i = 0u; i < sizeof...(Characters); i++)
+      {
+        if(iter[i] != characters[i])
+        {
+          return false;
+        }
+      }
+
+      iter += sizeof...(Characters);
+      return true;
+    }
+  };
+
+  template<class... Parsers>
+  struct Sequence
+  {
+    static bool Match(const char*& iter, const char* end, CaptureCollection* captures)
+    {
+      const char* tmpIter      = iter;
+      const std::size_t marker = captures != nullptr ? captures->size() : 0u;
+      if(!(Parsers::Match(tmpIter, end, captures) && ...))
+      {
+        if(captures != nullptr)
+        {
+          captures->resize(marker);
+        }
+
+        return false;
+      }
+
+      iter = tmpIter;
+      return true;
+    }
+  };
+
+  template<class... Parsers>
+  struct Choice
+  {
+    static bool Match(const char*& iter, const char* end, CaptureCollection* captures) { return (Parsers::Match(iter, end, captures) || ...); }
+  };
+
+  template<class Parser, std::size_t Min = 0u, std::size_t Max = std::numeric_limits<std::size_t>::max()>
+  struct Repeat
+  {
+    static bool Match(const char*& iter, const char* end, CaptureCollection* captures)
+    {
+      const char* tmpIter      = iter;
+      const std::size_t marker = captures != nullptr ? captures->size() : 0u;
+
+      std::size_t count = 0u;
+      while(count < Max)
+      {
+        const char* previous = tmpIter;
+        if(!Parser::Match(tmpIter, end, captures) || tmpIter == previous)
+        {
+          break;
+        }
+
+        count++;
+      }
+
+      if(count < Min)
+      {
+        if(captures != nullptr)
+        {
+          captures->resize(marker);
+        }
+
+        return false;
+      }
+
+      iter = tmpIter;
+      return true;
+    }
+  };
+
+  template<class Parser>
+  using Optional = Repeat<Parser, 0u, 1u>;
+
+  template<class Parser>
+  using OneOrMore = Repeat<Parser, 1u>;
+
+  template<class Parser>
+  struct Capture
+  {
+    static bool Match(const char*& iter, const char* end, CaptureCollection* captures)
+    {
+      const char* begin = iter;
+      if(!Parser::Match(iter, end, captures))
+      {
+        return false;
+      }
+
+      if(captures != nullptr)
+      {
+        captures->emplace_back(begin, static_cast<std::size_t>(iter - begin));
+      }
+
+      return true;
+    }
+  };
+
+  struct End
+  {
+    static bool Match(const char*& iter, const char* end, CaptureCollection*) { return iter == end; }
+  };
+
+  struct IsAny
+  {
+    static constexpr bool Test(char) { return true; }
+  };
+
+  struct IsSpace
+  {
+    static constexpr bool Test(char character) { return character == ' ' || (character >= '\t' && character <= '\r'); }
+  };
+
+  struct IsDigit
+  {
+    static constexpr bool Test(char character) { return character >= '0' && character <= '9'; }
+  };
+
+  struct IsAlpha
+  {
+    static constexpr bool Test(char character) { return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z'); }
+  };
+
+  template<char First, char Last>
+  struct IsRange
+  {
+    static constexpr bool Test(char character) { return character >= First && character <= Last; }
+  };
+
+  template<char... Characters>
+  struct IsOneOf
+  {
+    static constexpr bool Test(char character) { return ((character == Characters) || ...); }
+  };
+
+  template<class Predicate>
+  struct IsNot
+  {
+    static constexpr bool Test(char character) { return !Predicate::Test(character); }
+  };
+
+  using Any   = CharClass<IsAny>;
+  using Space = CharClass<IsSpace>;
+  using Digit = CharClass<IsDigit>;
+  using Alpha = CharClass<IsAlpha>;
+
+  template<char First, char Last>
+  using Range = CharClass<IsRange<First, Last>>;
+
+  template<char... Characters>
+  using OneOf = CharClass<IsOneOf<Characters...>>;
+
+  template<char... Characters>
+  using NoneOf = CharClass<IsNot<IsOneOf<Characters...>>>;
+
+  template<class Parser>
+  bool Parse(ParserBase& parser, CaptureCollection* captures)
+  {
+    const std::string_view text = parser.GetRemainingText();
+    const char* iter            = text.data();
+    if(!Parser::Match(iter, text.data() + text.length(), captures))
+    {
+      return false;
+    }
+
+    parser.Next(static_cast<std::size_t>(iter - text.data()));
+    return true;
+  }
+
+  template<class Parser>
+  bool Parse(ParserBase& parser, CaptureCollection& captures)
+  {
+    return Parse<Parser>(parser, &captures);
+  }
+
+  template<class Parser>
+  bool Parse(ParserBase& parser)
+  {
+    return Parse<Parser>(parser, nullptr);
+  }
+} // namespace Text::Parsing::Combinators
+
+#endif // __TEXT_PARSING__COMBINATORS_HPP__
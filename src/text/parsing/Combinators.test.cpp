@@ -0,0 +1,71 @@
+#include "CommandParser.hpp"
+#include "Combinators.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ::testing;
+using namespace Text::Parsing;
+using namespace Text::Parsing::Combinators;
+
+namespace UnitTest
+{
+  using Escaped      = Sequence<Literal<'\\'>, Any>;
+  using Identifier   = OneOrMore<Choice<Alpha, Digit, OneOf<'_', '.'>>>;
+  using Argument     = OneOrMore<Choice<Escaped, CharClass<IsNot<IsSpace>>>>;
+  using DoubleQuoted = Sequence<Literal<'"'>, Capture<Repeat<Choice<Escaped, NoneOf<'"'>>>>, Literal<'"'>>;
+  using SingleQuoted = Sequence<Literal<'\''>, Capture<Repeat<Choice<Escaped, NoneOf<'\''>>>>, Literal<'\''>>;
+  using Arguments    = Sequence<Repeat<Sequence<OneOrMore<Space>, Choice<DoubleQuoted, SingleQuoted, Capture<Argument>>>>, Repeat<Space>, End>;
+  using Command      = Sequence<Repeat<Space>, Capture<Identifier>, Arguments>;
+
+  TEST(Combinators, Primitives)
+  {
+    Parser parser("abc 123");
+
+    ASSERT_FALSE((Parse<Literal<'a', 'b', 'd'>>(parser)));
+    ASSERT_EQ(parser.GetPosition(), 0u);
+
+    ASSERT_TRUE((Parse<Literal<'a', 'b'>>(parser)));
+    ASSERT_EQ(parser.GetPosition(), 2u);
+
+    CaptureCollection captures;
+    ASSERT_FALSE((Parse<Sequence<Capture<Alpha>, Digit>>(parser, captures)));
+    ASSERT_TRUE(captures.empty());
+    ASSERT_EQ(parser.GetPosition(), 2u);
+
+    ASSERT_TRUE((Parse<Sequence<Capture<Alpha>, Space, Capture<Repeat<Digit, 1u, 2u>>>>(parser, captures)));
+    ASSERT_EQ(captures, (CaptureCollection {"c", "12"}));
+    ASSERT_EQ(parser.GetPosition(), 6u);
+
+    ASSERT_FALSE((Parse<Sequence<Digit, Digit>>(parser)));
+    ASSERT_TRUE((Parse<Choice<Alpha, Combinators::Range<'0', '3'>>>(parser)));
+    ASSERT_TRUE((Parse<End>(parser)));
+    ASSERT_FALSE(parser.GetState());
+  }
+
+  TEST(Combinators, CommandArguments)
+  {
+    std::vector<std::string> expected;
+    CommandParser::CallbackCollection commands;
+    commands["cmd"] = [&expected](const std::vector<std::string>& args) {
+      expected = args;
+      return 0;
+    };
+
+    CommandParser instance(&commands);
+    for(const char* text : {"cmd", "cmd abc", "  cmd abc 123 \"abc 123\" ", "cmd 'a b' \"c \\\" d\" e\\ f"})
+    {
+      instance.Execute(text);
+
+      Parser parser(text);
+      CaptureCollection captures;
+      ASSERT_TRUE((Parse<Command>(parser, captures)));
+      ASSERT_FALSE(parser.GetState());
+      ASSERT_EQ(captures.front(), "cmd");
+      ASSERT_EQ(std::vector<std::string>(captures.begin() + 1, captures.end()), expected);
+    }
+  }
+} // namespace UnitTest
@@ -13,48 +13,103 @@ namespace Text::Parsing
     std::string identifier = ParseIdentifier();
     if(identifier.empty())
     {
-      throw Exception::SyntaxError("Empty identifier", GetIndex());
+      throw Exception::SyntaxError("Empty identifier", GetIndex(), GetLocation());
     }
 
-    const auto iter = m_pCallbacks->find(identifier);
-    if(iter == m_pCallbacks->end())
+    const CommandParser::CallbackType* pCallback = m_Callbacks.Find(identifier);
+    if(pCallback == nullptr)
     {
-      throw Exception::SyntaxError("Unknown identifier", GetIndex() - identifier.length());
+      throw CreateUnknownIdentifierError(identifier);
     }
 
-    return iter->second(ParseArguments());
+    return (*pCallback)(ParseArguments());
   }
 
-  const CommandParser::CallbackCollection* CommandParser::GetCallbacks() const { return m_pCallbacks; }
-  void CommandParser::SetCallbacks(const CommandParser::CallbackCollection* value) { m_pCallbacks = value; }
+  bool CommandParser::ExecuteNext(int& result)
+  {
+    Next(Parser::IsWhitespace);
+    Discard();
+    if(!GetState())
+    {
+      return false;
+    }
+
+    const std::size_t start = GetIndex();
+    std::string identifier  = ParseIdentifier();
+    if(IsStarved())
+    {
+      Prev(GetIndex() - start);
+      return false;
+    }
+    else if(identifier.empty())
+    {
+      throw Exception::SyntaxError("Empty identifier", GetIndex(), GetLocation());
+    }
+
+    const CommandParser::CallbackType* pCallback = m_Callbacks.Find(identifier);
+    if(pCallback == nullptr)
+    {
+      throw CreateUnknownIdentifierError(identifier);
+    }
 
-  CommandParser::CommandParser(const CommandParser::CallbackCollection* callbacks)
+    const std::vector<std::string> args = ParseArguments(true);
+    if(IsStarved())
+    {
+      Prev(GetIndex() - start);
+      return false;
+    }
+
+    result = (*pCallback)(args);
+    return true;
+  }
+
+  StringMapView<CommandParser::CallbackType> CommandParser::GetCallbacks() const { return m_Callbacks; }
+  void CommandParser::SetCallbacks(StringMapView<CommandParser::CallbackType> value) { m_Callbacks = value; }
+  const NameIndex* CommandParser::GetNameIndex() const { return m_pNameIndex; }
+  void CommandParser::SetNameIndex(const NameIndex* value) { m_pNameIndex = value; }
+
+  CommandParser::CommandParser(StringMapView<CommandParser::CallbackType> callbacks)
       : Parser()
-      , m_pCallbacks(callbacks)
+      , m_Callbacks(callbacks)
+      , m_pNameIndex(nullptr)
   {}
 
   CommandParser::CommandParser()
       : Parser()
-      , m_pCallbacks()
+      , m_Callbacks()
+      , m_pNameIndex(nullptr)
   {}
 
   CommandParser::CommandParser(const CommandParser& other)
       : Parser(other)
-      , m_pCallbacks(other.m_pCallbacks)
+      , m_Callbacks(other.m_Callbacks)
+      , m_pNameIndex(other.m_pNameIndex)
   {}
 
   CommandParser::CommandParser(CommandParser&& other)
       : Parser(std::move(other))
-      , m_pCallbacks(std::move(other.m_pCallbacks))
+      , m_Callbacks(std::move(other.m_Callbacks))
+      , m_pNameIndex(std::move(other.m_pNameIndex))
   {}
 
-  std::vector<std::string> CommandParser::ParseArguments()
+  std::vector<std::string> CommandParser::ParseArguments() { return ParseArguments(false); }
+
+  Exception::SyntaxError CommandParser::CreateUnknownIdentifierError(const std::string& identifier) const
+  {
+    const std::size_t index = GetIndex() - identifier.length();
+    return Exception::SyntaxError("Unknown identifier",
+                                  index,
+                                  GetLocation(index),
+                                  (m_pNameIndex != nullptr) ? m_pNameIndex->Suggest(identifier) : std::vector<std::string>());
+  }
+
+  std::vector<std::string> CommandParser::ParseArguments(bool isLineTerminated)
   {
     std::vector<std::string> results;
     while(GetState())
     {
-      Next(Parser::IsWhitespace);
-      if(!GetState())
+      Next(isLineTerminated ? Parser::IsBlank : Parser::IsWhitespace);
+      if(!GetState() || GetCurrent() == '\n')
       {
         return results;
       }
@@ -64,9 +119,13 @@ namespace Text::Parsing
       if(Parser::IsString(current))
       {
         tmpResult = ParseString();
-        if(GetCurrent() != current)
+        if(IsStarved())
+        {
+          return results;
+        }
+        else if(GetCurrent() != current)
         {
-          throw Exception::SyntaxError("Unterminated string: " + tmpResult, GetIndex() - tmpResult.length());
+          throw Exception::SyntaxError("Unterminated string: " + tmpResult, GetIndex() - tmpResult.length(), GetLocation(GetIndex() - tmpResult.length()));
         }
 
         Next();
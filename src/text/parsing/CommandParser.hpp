@@ -2,6 +2,9 @@
 #define __TEXT_PARSING__COMMANDPARSER_HPP__
 
 #include "Parser.hpp"
+#include "text/Common.hpp"
+#include "text/NameIndex.hpp"
+#include "text/exception/SyntaxError.hpp"
 
 #include <unordered_map>
 #include <vector>
@@ -12,14 +15,17 @@ namespace Text::Parsing
   {
     public:
     using CallbackType       = std::function<int(const std::vector<std::string>&)>;
-    using CallbackCollection = std::unordered_map<std::string, CommandParser::CallbackType>;
+    using CallbackCollection = std::unordered_map<std::string, CommandParser::CallbackType, StringHash>;
 
     int Execute(const std::string& text);
+    bool ExecuteNext(int& result);
 
-    const CommandParser::CallbackCollection* GetCallbacks() const;
-    void SetCallbacks(const CommandParser::CallbackCollection* value);
+    StringMapView<CommandParser::CallbackType> GetCallbacks() const;
+    void SetCallbacks(StringMapView<CommandParser::CallbackType> value);
+    const NameIndex* GetNameIndex() const;
+    void SetNameIndex(const NameIndex* value);
 
-    CommandParser(const CommandParser::CallbackCollection* callbacks);
+    CommandParser(StringMapView<CommandParser::CallbackType> callbacks);
     CommandParser();
     CommandParser(const CommandParser& other);
     CommandParser(CommandParser&& other);
@@ -34,7 +40,11 @@ namespace Text::Parsing
     private:
     using Parser::SetText;
 
-    const CommandParser::CallbackCollection* m_pCallbacks;
+    std::vector<std::string> ParseArguments(bool isLineTerminated);
+    Exception::SyntaxError CreateUnknownIdentifierError(const std::string& identifier) const;
+
+    StringMapView<CommandParser::CallbackType> m_Callbacks;
+    const NameIndex* m_pNameIndex;
   };
 } // namespace Text::Parsing
 
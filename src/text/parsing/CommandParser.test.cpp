@@ -1,5 +1,8 @@
 #include "CommandParser.hpp"
+#include "text/exception/SyntaxError.hpp"
 
+#include <cstdio>
+#include <fstream>
 #include <functional>
 #include <string>
 #include <unordered_map>
@@ -24,6 +27,22 @@ namespace UnitTest
     ASSERT_EQ(instance.GetPosition(), Parser::NoPos);
   }
 
+  TEST(CommandParser, LegacyCallbackCollection)
+  {
+    std::unordered_map<std::string, CommandParser::CallbackType> commands;
+    commands["argcnt"] = [](const std::vector<std::string>& args) { return static_cast<int>(args.size()); };
+
+    CommandParser instance(&commands);
+
+    ASSERT_EQ(instance.Execute("argcnt abc 123"), 2);
+    ASSERT_THROW(instance.Execute("argcmp abc"), Text::Exception::SyntaxError);
+    ASSERT_TRUE(instance.GetCallbacks() != nullptr);
+
+    instance.SetCallbacks(nullptr);
+    ASSERT_TRUE(instance.GetCallbacks() == nullptr);
+    ASSERT_THROW(instance.Execute("argcnt abc"), Text::Exception::SyntaxError);
+  }
+
   TEST(CommandParser, ArgumentCompare)
   {
     CommandParser::CallbackCollection commands;
@@ -48,4 +67,118 @@ namespace UnitTest
     ASSERT_FALSE(instance.GetState());
     ASSERT_EQ(instance.GetPosition(), Parser::NoPos);
   }
+
+  TEST(CommandParser, ErrorLocation)
+  {
+    CommandParser::CallbackCollection commands;
+    commands["argcnt"] = [](const std::vector<std::string>& args) { return static_cast<int>(args.size()); };
+
+    CommandParser instance(&commands);
+
+    try
+    {
+      instance.Execute("argcnt abc\n123 \"abc 123");
+      FAIL();
+    }
+    catch(const Text::Exception::SyntaxError& e)
+    {
+      ASSERT_EQ(e.GetIndex(), 16u);
+      ASSERT_EQ(e.GetLocation().GetLine(), 2u);
+      ASSERT_EQ(e.GetLocation().GetColumn(), 6u);
+    }
+  }
+
+  TEST(CommandParser, Suggestions)
+  {
+    CommandParser::CallbackCollection commands;
+    commands["list"] = [](const std::vector<std::string>&) { return 0; };
+    commands["load"] = [](const std::vector<std::string>&) { return 0; };
+    commands["save"] = [](const std::vector<std::string>&) { return 0; };
+
+    const Text::NameIndex index = Text::NameIndex::FromKeys(commands);
+    CommandParser instance(&commands);
+    try
+    {
+      instance.Execute("lsit abc");
+      FAIL();
+    }
+    catch(const Text::Exception::SyntaxError& e)
+    {
+      ASSERT_TRUE(e.GetSuggestions().empty());
+    }
+
+    instance.SetNameIndex(&index);
+    try
+    {
+      instance.Execute("lsit abc");
+      FAIL();
+    }
+    catch(const Text::Exception::SyntaxError& e)
+    {
+      ASSERT_EQ(e.GetIndex(), 0u);
+      ASSERT_EQ(e.GetSuggestions(), (std::vector<std::string> {"list"}));
+    }
+  }
+
+  TEST(CommandParser, Stream)
+  {
+    std::vector<std::vector<std::string>> calls;
+    CommandParser::CallbackCollection commands;
+    commands["args"] = [&calls](const std::vector<std::string>& args) {
+      calls.push_back(args);
+      return static_cast<int>(args.size());
+    };
+
+    CommandParser instance(&commands);
+    int result = -1;
+
+    instance.Append("ar");
+    ASSERT_FALSE(instance.ExecuteNext(result));
+
+    instance.Append("gs abc \"abc ");
+    ASSERT_FALSE(instance.ExecuteNext(result));
+
+    instance.Append("123\"\n\nargs 1");
+    ASSERT_TRUE(instance.ExecuteNext(result));
+    ASSERT_EQ(result, 2);
+    ASSERT_FALSE(instance.ExecuteNext(result));
+
+    instance.Append("23 456");
+    instance.Close();
+    ASSERT_TRUE(instance.ExecuteNext(result));
+    ASSERT_EQ(result, 2);
+    ASSERT_FALSE(instance.ExecuteNext(result));
+
+    ASSERT_EQ(calls.size(), 2u);
+    ASSERT_EQ(calls[0], (std::vector<std::string> {"abc", "abc 123"}));
+    ASSERT_EQ(calls[1], (std::vector<std::string> {"123", "456"}));
+  }
+
+  TEST(CommandParser, MappedFile)
+  {
+    const std::string path = ::testing::TempDir() + "CommandParser.MappedFile.txt";
+    {
+      std::ofstream stream(path, std::ios::out | std::ios::binary);
+      stream << "argcnt abc 123\n\nargcnt \"abc 123\"\nargcnt";
+    }
+
+    CommandParser::CallbackCollection commands;
+    commands["argcnt"] = [](const std::vector<std::string>& args) { return static_cast<int>(args.size()); };
+
+    std::vector<int> results;
+    {
+      MappedFile file(path);
+      CommandParser instance(&commands);
+      instance.SetSource(file);
+
+      int result;
+      while(instance.ExecuteNext(result))
+      {
+        results.push_back(result);
+      }
+    }
+
+    std::remove(path.c_str());
+    ASSERT_EQ(results, (std::vector<int> {2, 1, 0}));
+  }
 } // namespace UnitTest
@@ -0,0 +1,32 @@
+#include "Location.hpp"
+
+namespace Text::Parsing
+{
+  bool Location::IsValid() const { return m_Line != 0u; }
+
+  std::size_t Location::GetLine() const { return m_Line; }
+
+  std::size_t Location::GetColumn() const { return m_Column; }
+
+  Location::Location(std::size_t line, std::size_t column)
+      : m_Line(line)
+      , m_Column(column)
+  {}
+
+  Location::Location()
+      : m_Line(0u)
+      , m_Column(0u)
+  {}
+
+  Location::Location(const Location& other)
+      : m_Line(other.m_Line)
+      , m_Column(other.m_Column)
+  {}
+
+  Location& Location::operator=(const Location& other)
+  {
+    m_Line   = other.m_Line;
+    m_Column = other.m_Column;
+    return *this;
+  }
+} // namespace Text::Parsing
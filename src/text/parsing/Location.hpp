@@ -0,0 +1,26 @@
+#ifndef __TEXT_PARSING__LOCATION_HPP__
+#define __TEXT_PARSING__LOCATION_HPP__
+
+#include <cstddef>
+
+namespace Text::Parsing
+{
+  class Location
+  {
+    public:
+    bool IsValid() const;
+    std::size_t GetLine() const;
+    std::size_t GetColumn() const;
+
+    Location(std::size_t line, std::size_t column);
+    Location();
+    Location(const Location& other);
+    Location& operator=(const Location& other);
+
+    private:
+    std::size_t m_Line;
+    std::size_t m_Column;
+  };
+} // namespace Text::Parsing
+
+#endif // __TEXT_PARSING__LOCATION_HPP__
@@ -0,0 +1,100 @@
+#include "MappedFile.hpp"
+
+#include <cerrno>
+#include <system_error>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+namespace Text::Parsing
+{
+  const char* MappedFile::GetData() const { return m_pData; }
+
+  std::size_t MappedFile::GetSize() const { return m_Size; }
+
+#if defined(__unix__) || defined(__APPLE__)
+  MappedFile::MappedFile(const std::string& path)
+      : m_pData(nullptr)
+      , m_Size(0u)
+      , m_Buffer()
+  {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+      throw std::system_error(errno, std::generic_category(), "Error opening file: " + path);
+    }
+
+    struct stat status;
+    if(::fstat(fd, &status) != 0)
+    {
+      const int error = errno;
+      ::close(fd);
+      throw std::system_error(error, std::generic_category(), "Error reading file status: " + path);
+    }
+
+    m_Size = static_cast<std::size_t>(status.st_size);
+    if(m_Size > 0u)
+    {
+      void* data = ::mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(data == MAP_FAILED)
+      {
+        const int error = errno;
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "Error mapping file: " + path);
+      }
+
+      (void)::madvise(data, m_Size, MADV_SEQUENTIAL);
+      m_pData = static_cast<const char*>(data);
+    }
+
+    ::close(fd);
+  }
+
+  MappedFile::~MappedFile()
+  {
+    if(m_pData != nullptr)
+    {
+      (void)::munmap(const_cast<char*>(m_pData), m_Size);
+    }
+  }
+#else
+  MappedFile::MappedFile(const std::string& path)
+      : m_pData(nullptr)
+      , m_Size(0u)
+      , m_Buffer()
+  {
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+    if(!stream)
+    {
+      throw std::system_error(errno, std::generic_category(), "Error opening file: " + path);
+    }
+
+    m_Buffer.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    m_pData = m_Buffer.data();
+    m_Size  = m_Buffer.size();
+  }
+
+  MappedFile::~MappedFile() = default;
+#endif
+
+  MappedFile::MappedFile(MappedFile&& other)
+      : m_pData(other.m_pData)
+      , m_Size(other.m_Size)
+      , m_Buffer(std::move(other.m_Buffer))
+  {
+    if(!m_Buffer.empty())
+    {
+      m_pData = m_Buffer.data();
+    }
+
+    other.m_pData = nullptr;
+    other.m_Size  = 0u;
+  }
+} // namespace Text::Parsing
@@ -0,0 +1,29 @@
+#ifndef __TEXT_PARSING__MAPPEDFILE_HPP__
+#define __TEXT_PARSING__MAPPEDFILE_HPP__
+
+#include <cstddef>
+#include <string>
+
+namespace Text::Parsing
+{
+  class MappedFile
+  {
+    public:
+    const char* GetData() const;
+    std::size_t GetSize() const;
+
+    MappedFile(const std::string& path);
+    MappedFile(MappedFile&& other);
+    ~MappedFile();
+
+    private:
+    const char* m_pData;
+    std::size_t m_Size;
+    std::string m_Buffer;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+  };
+} // namespace Text::Parsing
+
+#endif // __TEXT_PARSING__MAPPEDFILE_HPP__
@@ -56,6 +56,7 @@ namespace Text::Parsing
   void Parser::SetDecimalPointCharacter(char value) { m_DecimalPointCharacter = value; }
 
   bool Parser::IsWhitespace(char character) { return std::isspace(character) != 0; }
+  bool Parser::IsBlank(char character) { return character != '\n' && std::isspace(character) != 0; }
   bool Parser::IsNumber(char character) { return std::isdigit(character) != 0; }
   bool Parser::IsString(char character) { return character == '\'' || character == '\"'; }
   bool Parser::IsIdentifier(char character) { return std::isalpha(character) != 0 || character == '_'; }
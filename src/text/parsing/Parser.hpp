@@ -21,6 +21,7 @@ namespace Text::Parsing
 
     protected:
     static bool IsWhitespace(char character);
+    static bool IsBlank(char character);
     static bool IsNumber(char character);
     static bool IsString(char character);
     static bool IsIdentifier(char character);
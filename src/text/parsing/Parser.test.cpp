@@ -1,5 +1,10 @@
 #include "Parser.hpp"
 
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 #include <gtest/gtest.h>
 
 using namespace ::testing;
@@ -160,4 +165,198 @@ namespace UnitTest
     ASSERT_FALSE(parser.GetState());
     ASSERT_EQ(parser.GetPosition(), Parser::NoPos);
   }
+
+  TEST(Parser, Location)
+  {
+    Parser parser("abc\n12345\n\nxyz");
+
+    ASSERT_EQ(parser.GetLocation().GetLine(), 1u);
+    ASSERT_EQ(parser.GetLocation().GetColumn(), 1u);
+
+    ASSERT_EQ(parser.GetLocation(2u).GetLine(), 1u);
+    ASSERT_EQ(parser.GetLocation(2u).GetColumn(), 3u);
+
+    ASSERT_EQ(parser.GetLocation(3u).GetLine(), 1u);
+    ASSERT_EQ(parser.GetLocation(3u).GetColumn(), 4u);
+
+    ASSERT_EQ(parser.GetLocation(12u).GetLine(), 4u);
+    ASSERT_EQ(parser.GetLocation(12u).GetColumn(), 2u);
+
+    ASSERT_EQ(parser.GetLocation(4u).GetLine(), 2u);
+    ASSERT_EQ(parser.GetLocation(4u).GetColumn(), 1u);
+
+    ASSERT_EQ(parser.GetLocation(9u).GetLine(), 2u);
+    ASSERT_EQ(parser.GetLocation(9u).GetColumn(), 6u);
+
+    ASSERT_EQ(parser.GetLocation(10u).GetLine(), 3u);
+    ASSERT_EQ(parser.GetLocation(10u).GetColumn(), 1u);
+
+    ASSERT_EQ(parser.GetLocation(14u).GetLine(), 4u);
+    ASSERT_EQ(parser.GetLocation(14u).GetColumn(), 4u);
+
+    parser.Next(6u);
+    ASSERT_EQ(parser.GetLocation().GetLine(), 2u);
+    ASSERT_EQ(parser.GetLocation().GetColumn(), 3u);
+
+    ASSERT_FALSE(parser.GetLocation(Parser::NoPos).IsValid());
+    ASSERT_FALSE(parser.GetLocation(100u).IsValid());
+  }
+
+  TEST(Parser, Stream)
+  {
+    Parser parser;
+
+    parser.Append("abc\n12");
+    ASSERT_TRUE(parser.IsOpen());
+    ASSERT_EQ(parser.Get([](char c) { return std::isalpha(c) != 0; }), "abc");
+    ASSERT_FALSE(parser.IsStarved());
+
+    parser.Next();
+    ASSERT_EQ(parser.Get([](char c) { return std::isdigit(c) != 0; }), "12");
+    ASSERT_TRUE(parser.IsStarved());
+
+    parser.Prev(2u);
+    parser.Discard();
+    ASSERT_EQ(parser.GetIndex(), 4u);
+    ASSERT_EQ(parser.GetText(), "12");
+
+    parser.Append("345 xyz");
+    parser.Close();
+    ASSERT_FALSE(parser.IsOpen());
+    ASSERT_EQ(parser.Find('x'), 10u);
+    ASSERT_EQ(parser.Get([](char c) { return std::isdigit(c) != 0; }), "12345");
+    ASSERT_FALSE(parser.IsStarved());
+    ASSERT_EQ(parser.GetPosition(), 9u);
+
+    ASSERT_EQ(parser.GetLocation().GetLine(), 2u);
+    ASSERT_EQ(parser.GetLocation().GetColumn(), 6u);
+    ASSERT_FALSE(parser.GetLocation(2u).IsValid());
+
+    parser.Next(1u);
+    parser.Discard();
+    ASSERT_EQ(parser.GetLocation().GetLine(), 2u);
+    ASSERT_EQ(parser.GetLocation().GetColumn(), 7u);
+    ASSERT_EQ(parser.Get(3u), "xyz");
+    ASSERT_FALSE(parser.GetState());
+    ASSERT_FALSE(parser.IsStarved());
+  }
+
+  TEST(Parser, Move)
+  {
+    Parser parser;
+    parser.Append("abc 123");
+    parser.Next(4u);
+
+    Parser instance(std::move(parser));
+    ASSERT_EQ(instance.GetText(), "abc 123");
+    ASSERT_EQ(instance.GetIndex(), 4u);
+    ASSERT_TRUE(instance.IsOpen());
+    ASSERT_EQ(instance.Get(3u), "123");
+
+    ASSERT_EQ(parser.GetText(), "");
+    ASSERT_EQ(parser.GetIndex(), Parser::NoPos);
+    ASSERT_FALSE(parser.IsOpen());
+    ASSERT_EQ(parser.GetRemainingText(), "");
+  }
+
+  TEST(Parser, Checkpoint)
+  {
+    Parser parser("Test 12345");
+
+    parser.Next(5u);
+    const auto checkpoint = parser.GetCheckpoint();
+    ASSERT_EQ(checkpoint.GetIndex(), 5u);
+
+    ASSERT_EQ(parser.Get(3u), "123");
+    parser.Restore(checkpoint);
+    ASSERT_EQ(parser.GetPosition(), 5u);
+    ASSERT_STREQ(parser.GetRemaining(), "12345");
+
+    parser.Discard();
+    parser.Restore(checkpoint);
+    ASSERT_EQ(parser.GetPosition(), 5u);
+
+    parser.Next(1u);
+    parser.Discard();
+    ASSERT_THROW(parser.Restore(checkpoint), std::out_of_range);
+  }
+
+  TEST(Parser, Memoize)
+  {
+    enum Rule : std::size_t
+    {
+      Expression,
+      Term
+    };
+
+    Parser parser;
+    std::size_t evaluations = 0u;
+
+    std::function<bool()> expression;
+    std::function<bool()> term;
+    const auto literal = [&parser](char c) {
+      if(parser.GetCurrent() != c)
+      {
+        return false;
+      }
+
+      parser.Next();
+      return true;
+    };
+
+    expression = [&]() {
+      return parser.Memoize(Rule::Expression, [&]() {
+        evaluations++;
+        const auto checkpoint = parser.GetCheckpoint();
+        if(term() && literal('+') && expression())
+        {
+          return true;
+        }
+
+        parser.Restore(checkpoint);
+        return term();
+      });
+    };
+
+    term = [&]() {
+      return parser.Memoize(Rule::Term, [&]() {
+        evaluations++;
+        const auto checkpoint = parser.GetCheckpoint();
+        if(literal('(') && expression() && literal(')'))
+        {
+          return true;
+        }
+
+        parser.Restore(checkpoint);
+        return literal('n');
+      });
+    };
+
+    const std::string text = "((((((((((n+n))))))))))";
+
+    parser.SetText(text);
+    ASSERT_TRUE(expression());
+    ASSERT_FALSE(parser.GetState());
+    ASSERT_EQ(parser.GetMemoHits(), 0u);
+    ASSERT_EQ(parser.GetMemoMisses(), 0u);
+    const std::size_t plainEvaluations = evaluations;
+
+    evaluations = 0u;
+    parser.SetMemoization(true);
+    parser.SetText(text);
+    ASSERT_TRUE(expression());
+    ASSERT_FALSE(parser.GetState());
+    ASSERT_GT(parser.GetMemoHits(), 0u);
+    ASSERT_EQ(parser.GetMemoMisses(), evaluations);
+    ASSERT_LE(evaluations, 2u * text.length());
+    ASSERT_LT(evaluations, plainEvaluations);
+
+    parser.SetText("(n+");
+    ASSERT_FALSE(expression());
+    ASSERT_EQ(parser.GetPosition(), 0u);
+
+    parser.ClearMemo();
+    ASSERT_EQ(parser.GetMemoHits(), 0u);
+    ASSERT_EQ(parser.GetMemoMisses(), 0u);
+  }
 } // namespace UnitTest
@@ -1,27 +1,240 @@
 #include "ParserBase.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <stdexcept>
 
 namespace Text::Parsing
 {
+  std::size_t ParserBase::Checkpoint::GetIndex() const { return m_Index; }
+
+  ParserBase::Checkpoint::Checkpoint(std::size_t index)
+      : m_Index(index)
+  {}
+
   bool ParserBase::GetState() const { return m_Index < m_Text.length(); }
 
   char ParserBase::GetCurrent() const { return GetState() ? m_Text[m_Index] : ParserBase::Invalid; }
 
-  std::size_t ParserBase::GetIndex() const { return m_Index; }
+  std::size_t ParserBase::GetIndex() const { return m_Index != ParserBase::NoPos ? m_Offset + m_Index : ParserBase::NoPos; }
 
-  std::size_t ParserBase::GetPosition() const { return GetState() ? m_Index : ParserBase::NoPos; }
+  std::size_t ParserBase::GetPosition() const { return GetState() ? m_Offset + m_Index : ParserBase::NoPos; }
 
-  std::string ParserBase::GetText() const { return m_Text; }
+  std::string ParserBase::GetText() const { return std::string(m_Text); }
 
   void ParserBase::SetText(const std::string& value)
   {
-    m_Text  = value;
+    m_Buffer     = value;
+    m_IsExternal = false;
+    ResetText(m_Buffer);
+  }
+
+  void ParserBase::SetSource(const MappedFile& value)
+  {
+    m_Buffer.clear();
+    m_Buffer.shrink_to_fit();
+    m_IsExternal = true;
+    ResetText(std::string_view(value.GetData(), value.GetSize()));
+  }
+
+  void ParserBase::Append(const std::string& value)
+  {
+    if(m_Index == ParserBase::NoPos)
+    {
+      m_Index = m_Text.length();
+    }
+
+    if(m_IsExternal)
+    {
+      m_Buffer.assign(m_Text);
+      m_IsExternal = false;
+    }
+
+    const std::size_t start = GetBufferIndex();
+    m_Buffer.append(value);
+    m_Text   = std::string_view(m_Buffer).substr(start);
+    m_IsOpen = true;
+
+    m_Memo.clear();
+  }
+
+  void ParserBase::Close() { m_IsOpen = false; }
+
+  void ParserBase::Discard()
+  {
+    if(m_Index == ParserBase::NoPos || m_Index == 0u)
+    {
+      return;
+    }
+
+    UpdateLineOffsets(m_Offset + m_Index);
+
+    m_Text.remove_prefix(m_Index);
+    if(!m_IsExternal && GetBufferIndex() * 2u >= m_Buffer.length())
+    {
+      m_Buffer.erase(0u, GetBufferIndex());
+      m_Text = m_Buffer;
+    }
+
+    m_Offset += m_Index;
     m_Index = 0u;
+
+    const auto line          = std::upper_bound(m_LineOffsets.cbegin(), m_LineOffsets.cend(), m_Offset) - 1;
+    const std::size_t pruned = static_cast<std::size_t>(std::distance(m_LineOffsets.cbegin(), line));
+    m_LineOffsets.erase(m_LineOffsets.cbegin(), line);
+    m_LineOffsetsBase += pruned;
+
+    m_Memo.clear();
   }
 
+  bool ParserBase::IsOpen() const { return m_IsOpen; }
+
+  bool ParserBase::IsStarved() const { return m_IsOpen && !GetState(); }
+
   const char* ParserBase::GetRemaining() const { return GetState() ? &m_Text[m_Index] : nullptr; }
 
+  std::string_view ParserBase::GetRemainingText() const { return GetState() ? m_Text.substr(m_Index) : std::string_view(); }
+
+  std::size_t ParserBase::Find(char character) const
+  {
+    if(!GetState())
+    {
+      return ParserBase::NoPos;
+    }
+
+    const char* begin = m_Text.data();
+    const void* match = std::memchr(begin + m_Index, character, m_Text.length() - m_Index);
+    return match != nullptr ? m_Offset + static_cast<std::size_t>(static_cast<const char*>(match) - begin) : ParserBase::NoPos;
+  }
+
+  Location ParserBase::GetLocation() const { return GetLocation(GetIndex()); }
+
+  Location ParserBase::GetLocation(std::size_t index) const
+  {
+    if(index == ParserBase::NoPos || index < m_Offset || index > m_Offset + m_Text.length())
+    {
+      return Location();
+    }
+
+    UpdateLineOffsets(index);
+
+    const auto line = std::upper_bound(m_LineOffsets.cbegin(), m_LineOffsets.cend(), index);
+    return Location(m_LineOffsetsBase + static_cast<std::size_t>(std::distance(m_LineOffsets.cbegin(), line)), index - *(line - 1) + 1u);
+  }
+
+  ParserBase::Checkpoint ParserBase::GetCheckpoint() const { return Checkpoint(GetIndex()); }
+
+  ParserBase& ParserBase::Restore(const Checkpoint& value)
+  {
+    if(value.m_Index == ParserBase::NoPos)
+    {
+      m_Index = ParserBase::NoPos;
+    }
+    else if(value.m_Index < m_Offset || value.m_Index > m_Offset + m_Text.length())
+    {
+      throw std::out_of_range("Checkpoint is outside of the buffered text");
+    }
+    else
+    {
+      m_Index = value.m_Index - m_Offset;
+    }
+
+    return *this;
+  }
+
+  bool ParserBase::GetMemoization() const { return m_IsMemoizing; }
+
+  void ParserBase::SetMemoization(bool value)
+  {
+    m_IsMemoizing = value;
+    m_Memo.clear();
+  }
+
+  bool ParserBase::Memoize(std::size_t rule, const std::function<bool()>& callback)
+  {
+    const Checkpoint checkpoint = GetCheckpoint();
+    if(!m_IsMemoizing)
+    {
+      const bool result = callback();
+      if(!result)
+      {
+        Restore(checkpoint);
+      }
+
+      return result;
+    }
+
+    const auto key  = std::make_pair(rule, checkpoint.m_Index);
+    const auto iter = m_Memo.find(key);
+    if(iter != m_Memo.cend())
+    {
+      m_MemoHits++;
+      Restore(Checkpoint(iter->second.End));
+      return iter->second.Result;
+    }
+
+    m_MemoMisses++;
+    const bool result = callback();
+    if(!result)
+    {
+      Restore(checkpoint);
+    }
+
+    m_Memo[key] = {result, GetIndex()};
+    return result;
+  }
+
+  void ParserBase::ClearMemo()
+  {
+    m_Memo.clear();
+    m_MemoHits   = 0u;
+    m_MemoMisses = 0u;
+  }
+
+  std::size_t ParserBase::GetMemoHits() const { return m_MemoHits; }
+
+  std::size_t ParserBase::GetMemoMisses() const { return m_MemoMisses; }
+
+  std::size_t ParserBase::MemoKeyHash::operator()(const std::pair<std::size_t, std::size_t>& value) const
+  {
+    return std::hash<std::size_t>()(value.first * 0x9E3779B97F4A7C15ull ^ value.second);
+  }
+
+  void ParserBase::UpdateLineOffsets(std::size_t index) const
+  {
+    if(index <= m_LineOffsetsEnd)
+    {
+      return;
+    }
+
+    const char* begin = m_Text.data();
+    const char* iter  = begin + (m_LineOffsetsEnd - m_Offset);
+    const char* end   = begin + (index - m_Offset);
+    while((iter = static_cast<const char*>(std::memchr(iter, '\n', static_cast<std::size_t>(end - iter)))) != nullptr)
+    {
+      iter++;
+      m_LineOffsets.push_back(m_Offset + static_cast<std::size_t>(iter - begin));
+    }
+
+    m_LineOffsetsEnd = index;
+  }
+
+  void ParserBase::ResetText(std::string_view value)
+  {
+    m_Text   = value;
+    m_Index  = 0u;
+    m_Offset = 0u;
+    m_IsOpen = false;
+
+    m_LineOffsets.assign(1u, 0u);
+    m_LineOffsetsBase = 0u;
+    m_LineOffsetsEnd  = 0u;
+
+    m_Memo.clear();
+  }
+
+  std::size_t ParserBase::GetBufferIndex() const { return !m_IsExternal ? m_Buffer.length() - m_Text.length() : 0u; }
+
   ParserBase& ParserBase::Next()
   {
     if(GetState())
@@ -50,8 +263,8 @@ namespace Text::Parsing
 
   ParserBase& ParserBase::Next(const std::regex& regex)
   {
-    std::smatch match;
-    if(std::regex_search(m_Text.cbegin() + m_Index, m_Text.cend(), match, regex))
+    std::cmatch match;
+    if(std::regex_search(m_Text.data() + m_Index, m_Text.data() + m_Text.length(), match, regex))
     {
       m_Index += match.begin()->str().length();
     }
@@ -110,8 +323,8 @@ namespace Text::Parsing
   ParserBase& ParserBase::Get(std::string& result, const std::regex& regex)
   {
     result.clear();
-    std::smatch match;
-    if(std::regex_search(m_Text.cbegin() + m_Index, m_Text.cend(), match, regex))
+    std::cmatch match;
+    if(std::regex_search(m_Text.data() + m_Index, m_Text.data() + m_Text.length(), match, regex))
     {
       result = match.begin()->str();
       m_Index += match.begin()->str().length();
@@ -148,27 +361,96 @@ namespace Text::Parsing
   }
 
   ParserBase::ParserBase(const std::string& text)
-      : m_Text(text)
+      : m_Buffer(text)
+      , m_Text(m_Buffer)
       , m_Index(0u)
+      , m_Offset(0u)
+      , m_IsOpen(false)
+      , m_IsExternal(false)
+      , m_LineOffsets(1u, 0u)
+      , m_LineOffsetsBase(0u)
+      , m_LineOffsetsEnd(0u)
+      , m_IsMemoizing(false)
+      , m_Memo()
+      , m_MemoHits(0u)
+      , m_MemoMisses(0u)
   {}
 
   ParserBase::ParserBase(const std::string&& text)
-      : m_Text(text)
+      : m_Buffer(text)
+      , m_Text(m_Buffer)
       , m_Index(0u)
+      , m_Offset(0u)
+      , m_IsOpen(false)
+      , m_IsExternal(false)
+      , m_LineOffsets(1u, 0u)
+      , m_LineOffsetsBase(0u)
+      , m_LineOffsetsEnd(0u)
+      , m_IsMemoizing(false)
+      , m_Memo()
+      , m_MemoHits(0u)
+      , m_MemoMisses(0u)
   {}
 
   ParserBase::ParserBase()
-      : m_Text()
+      : m_Buffer()
+      , m_Text()
       , m_Index(ParserBase::NoPos)
+      , m_Offset(0u)
+      , m_IsOpen(false)
+      , m_IsExternal(false)
+      , m_LineOffsets(1u, 0u)
+      , m_LineOffsetsBase(0u)
+      , m_LineOffsetsEnd(0u)
+      , m_IsMemoizing(false)
+      , m_Memo()
+      , m_MemoHits(0u)
+      , m_MemoMisses(0u)
   {}
 
   ParserBase::ParserBase(const ParserBase& other)
-      : m_Text(other.m_Text)
+      : m_Buffer(other.m_Buffer)
+      , m_Text(!other.m_IsExternal ? std::string_view(m_Buffer).substr(other.GetBufferIndex()) : other.m_Text)
       , m_Index(other.m_Index)
+      , m_Offset(other.m_Offset)
+      , m_IsOpen(other.m_IsOpen)
+      , m_IsExternal(other.m_IsExternal)
+      , m_LineOffsets(other.m_LineOffsets)
+      , m_LineOffsetsBase(other.m_LineOffsetsBase)
+      , m_LineOffsetsEnd(other.m_LineOffsetsEnd)
+      , m_IsMemoizing(other.m_IsMemoizing)
+      , m_Memo(other.m_Memo)
+      , m_MemoHits(other.m_MemoHits)
+      , m_MemoMisses(other.m_MemoMisses)
   {}
 
   ParserBase::ParserBase(ParserBase&& other)
-      : m_Text(std::move(other.m_Text))
+      : m_Buffer()
+      , m_Text(other.m_Text)
       , m_Index(std::move(other.m_Index))
-  {}
+      , m_Offset(std::move(other.m_Offset))
+      , m_IsOpen(std::move(other.m_IsOpen))
+      , m_IsExternal(std::move(other.m_IsExternal))
+      , m_LineOffsets(std::move(other.m_LineOffsets))
+      , m_LineOffsetsBase(std::move(other.m_LineOffsetsBase))
+      , m_LineOffsetsEnd(std::move(other.m_LineOffsetsEnd))
+      , m_IsMemoizing(std::move(other.m_IsMemoizing))
+      , m_Memo(std::move(other.m_Memo))
+      , m_MemoHits(std::move(other.m_MemoHits))
+      , m_MemoMisses(std::move(other.m_MemoMisses))
+  {
+    if(!m_IsExternal)
+    {
+      const std::size_t start = other.GetBufferIndex();
+      m_Buffer                = std::move(other.m_Buffer);
+      m_Text                  = std::string_view(m_Buffer).substr(start);
+    }
+
+    other.m_Buffer.clear();
+    other.m_IsExternal = false;
+    other.ResetText(std::string_view());
+    other.m_Index      = ParserBase::NoPos;
+    other.m_MemoHits   = 0u;
+    other.m_MemoMisses = 0u;
+  }
 } // namespace Text::Parsing
@@ -1,9 +1,16 @@
 #ifndef __TEXT_PARSING__PARSERBASE_HPP__
 #define __TEXT_PARSING__PARSERBASE_HPP__
 
+#include "Location.hpp"
+#include "MappedFile.hpp"
+
 #include <functional>
 #include <regex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace Text::Parsing
 {
@@ -13,6 +20,19 @@ namespace Text::Parsing
     static constexpr std::size_t NoPos = std::string::npos;
     static constexpr char Invalid      = static_cast<char>(EOF);
 
+    class Checkpoint
+    {
+      public:
+      std::size_t GetIndex() const;
+
+      private:
+      friend class ParserBase;
+
+      Checkpoint(std::size_t index);
+
+      std::size_t m_Index;
+    };
+
     bool GetState() const;
     char GetCurrent() const;
     std::size_t GetIndex() const;
@@ -20,8 +40,31 @@ namespace Text::Parsing
 
     std::string GetText() const;
     void SetText(const std::string& value);
+    void SetSource(const MappedFile& value);
+    void SetSource(MappedFile&& value) = delete;
+
+    void Append(const std::string& value);
+    void Close();
+    void Discard();
+    bool IsOpen() const;
+    bool IsStarved() const;
 
     const char* GetRemaining() const;
+    std::string_view GetRemainingText() const;
+    std::size_t Find(char character) const;
+
+    Location GetLocation() const;
+    Location GetLocation(std::size_t index) const;
+
+    Checkpoint GetCheckpoint() const;
+    ParserBase& Restore(const Checkpoint& value);
+
+    bool GetMemoization() const;
+    void SetMemoization(bool value);
+    bool Memoize(std::size_t rule, const std::function<bool()>& callback);
+    void ClearMemo();
+    std::size_t GetMemoHits() const;
+    std::size_t GetMemoMisses() const;
 
     ParserBase& Next();
     ParserBase& Next(std::size_t count);
@@ -51,8 +94,36 @@ namespace Text::Parsing
     ParserBase(ParserBase&& other);
 
     private:
-    std::string m_Text;
+    struct MemoEntry
+    {
+      bool Result;
+      std::size_t End;
+    };
+
+    struct MemoKeyHash
+    {
+      std::size_t operator()(const std::pair<std::size_t, std::size_t>& value) const;
+    };
+
+    std::string m_Buffer;
+    std::string_view m_Text;
     std::size_t m_Index;
+    std::size_t m_Offset;
+    bool m_IsOpen;
+    bool m_IsExternal;
+
+    mutable std::vector<std::size_t> m_LineOffsets;
+    mutable std::size_t m_LineOffsetsBase;
+    mutable std::size_t m_LineOffsetsEnd;
+
+    bool m_IsMemoizing;
+    std::unordered_map<std::pair<std::size_t, std::size_t>, MemoEntry, MemoKeyHash> m_Memo;
+    std::size_t m_MemoHits;
+    std::size_t m_MemoMisses;
+
+    void UpdateLineOffsets(std::size_t index) const;
+    void ResetText(std::string_view value);
+    std::size_t GetBufferIndex() const;
   };
 } // namespace Text::Parsing
 